@@ -5,15 +5,24 @@
 #ifndef INCLUDE_V8_JSON_H_
 #define INCLUDE_V8_JSON_H_
 
+#include <stddef.h>
+
+#include <memory>
+
 #include "v8-local-handle.h"  // NOLINT(build/include_directory)
 #include "v8config.h"         // NOLINT(build/include_directory)
 
 namespace v8 {
 
 class Context;
+class OutputStream;
 class Value;
 class String;
 
+namespace internal {
+class JsonChunkedSource;
+}  // namespace internal
+
 /**
  * A JSON Parser and Stringifier.
  */
@@ -40,6 +49,73 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> Stringify(
       Local<Context> context, Local<Value> json_object,
       Local<String> gap = Local<String>());
+
+  /**
+   * Stringifies |json_object| like Stringify, but writes the result as UTF-8
+   * into |stream| in chunks of stream->GetChunkSize() bytes instead of
+   * creating a string, so that large values can be sent to a file or socket
+   * without first materializing the whole text on the V8 heap.
+   * EndOfStream is called once all output has been written, and only then:
+   * if stringification throws, e.g. from a toJSON method, the chunks written
+   * so far are an incomplete prefix of the text and EndOfStream is never
+   * called, so the embedder has to discard them when the result is nothing.
+   * Once the stream returns kAbort from WriteAsciiChunk, serialization stops
+   * right away, without calling any further toJSON methods, and EndOfStream
+   * is not called either.
+   *
+   * \param json_object The JSON-serializable object to stringify.
+   * \param stream The stream receiving the output.
+   * \return Whether the output was written completely, i.e. false if the
+   *   stream aborted, or nothing if stringification threw an exception.
+   */
+  static V8_WARN_UNUSED_RESULT Maybe<bool> StringifyToStream(
+      Local<Context> context, Local<Value> json_object, OutputStream* stream,
+      Local<String> gap = Local<String>());
+
+  /**
+   * Collects UTF-8 encoded JSON text that the embedder receives in chunks,
+   * e.g. from the network, and parses it once it is complete, without the
+   * embedder having to assemble it into a v8::String first.
+   *
+   * This is not an incremental parser: AddChunk only buffers the text, and
+   * all parsing happens in Finish, which needs the whole text and blocks
+   * until the value has been created. The buffered text is held off-heap
+   * until then.
+   *
+   * Chunks are copied when they are added, so the embedder may reuse its
+   * buffers right away, and multi-byte characters may be split between
+   * chunks. Pure ASCII input, which is the common case for JSON, is parsed in
+   * place without copying it onto the V8 heap.
+   *
+   * A ChunkedParser is not bound to an isolate until Finish is called, and
+   * can only be finished once.
+   */
+  class V8_EXPORT ChunkedParser {
+   public:
+    ChunkedParser();
+    ~ChunkedParser();
+
+    // Prevent copying.
+    ChunkedParser(const ChunkedParser&) = delete;
+    ChunkedParser& operator=(const ChunkedParser&) = delete;
+
+    /**
+     * Appends the next |length| bytes of the UTF-8 encoded JSON text to the
+     * buffered text. Nothing is parsed yet.
+     */
+    void AddChunk(const char* data, size_t length);
+
+    /**
+     * Parses the text added so far and returns the corresponding value, or
+     * throws a SyntaxError like JSON::Parse.
+     *
+     * \param context The context in which to parse and create the value.
+     */
+    V8_WARN_UNUSED_RESULT MaybeLocal<Value> Finish(Local<Context> context);
+
+   private:
+    std::unique_ptr<internal::JsonChunkedSource> impl_;
+  };
 };
 
 }  // namespace v8
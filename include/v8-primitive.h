@@ -479,6 +479,18 @@ class V8_EXPORT String : public Name {
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> NewExternalOneByte(
       Isolate* isolate, ExternalOneByteStringResource* resource);
 
+  /**
+   * Creates a new string from the UTF-8 data defined in the given resource.
+   * ASCII data means the same in UTF-8 and Latin-1, so in that case the
+   * result is an external one-byte string that uses the resource without
+   * copying or transcoding it, with the same lifetime rules as for
+   * NewExternalOneByte. Otherwise the data is decoded into a new string and
+   * the resource is disposed of right away. If the string cannot be created,
+   * the resource is not disposed of.
+   */
+  static V8_WARN_UNUSED_RESULT MaybeLocal<String> NewExternalUtf8(
+      Isolate* isolate, ExternalOneByteStringResource* resource);
+
   /**
    * Associate an external string resource with this string by transforming it
    * in place so that existing references to this string in the JavaScript heap
@@ -3293,6 +3293,27 @@ MaybeLocal<Value> JSON::Parse(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+JSON::ChunkedParser::ChunkedParser() : impl_(new i::JsonChunkedSource()) {}
+
+JSON::ChunkedParser::~ChunkedParser() = default;
+
+void JSON::ChunkedParser::AddChunk(const char* data, size_t length) {
+  Utils::ApiCheck(impl_ != nullptr, "v8::JSON::ChunkedParser::AddChunk",
+                  "Parser has already been finished");
+  impl_->AddChunk(data, length);
+}
+
+MaybeLocal<Value> JSON::ChunkedParser::Finish(Local<Context> context) {
+  Utils::ApiCheck(impl_ != nullptr, "v8::JSON::ChunkedParser::Finish",
+                  "Parser has already been finished");
+  PREPARE_FOR_EXECUTION(context, JSON, ParseChunked);
+  std::unique_ptr<i::JsonChunkedSource> source = std::move(impl_);
+  Local<Value> result;
+  has_exception = !ToLocal<Value>(source->Parse(i_isolate), &result);
+  RETURN_ON_FAILED_EXECUTION(Value);
+  RETURN_ESCAPED(result);
+}
+
 MaybeLocal<String> JSON::Stringify(Local<Context> context,
                                    Local<Value> json_object,
                                    Local<String> gap) {
@@ -3313,6 +3334,24 @@ MaybeLocal<String> JSON::Stringify(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+Maybe<bool> JSON::StringifyToStream(Local<Context> context,
+                                    Local<Value> json_object,
+                                    OutputStream* stream, Local<String> gap) {
+  Utils::ApiCheck(stream->GetChunkSize() > 0, "v8::JSON::StringifyToStream",
+                  "Invalid stream chunk size");
+  auto i_isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  ENTER_V8(i_isolate, context, JSON, StringifyToStream, i::HandleScope);
+  auto object = Utils::OpenHandle(*json_object);
+  i::Handle<i::String> gap_string = gap.IsEmpty()
+                                        ? i_isolate->factory()->empty_string()
+                                        : Utils::OpenHandle(*gap);
+  Maybe<bool> result =
+      i::JsonStringifyToStream(i_isolate, object, gap_string, stream);
+  has_exception = result.IsNothing();
+  RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
+  return result;
+}
+
 // --- V a l u e   S e r i a l i z a t i o n ---
 
 SharedValueConveyor::SharedValueConveyor(SharedValueConveyor&& other) noexcept
@@ -5819,19 +5858,27 @@ static int WriteUtf8Impl(base::Vector<const Char> string, char* write_start,
       up_to = std::min(up_to, read_index + writable_length);
     }
     // Write the characters to the stream.
-    if (sizeof(Char) == 1) {
-      // Simply memcpy if we only have ASCII characters.
-      uint8_t char_mask = 0;
-      for (int i = read_index; i < up_to; i++) char_mask |= read_start[i];
-      if ((char_mask & 0x80) == 0) {
-        int copy_length = up_to - read_index;
-        memcpy(current_write, read_start + read_index, copy_length);
-        current_write += copy_length;
-        read_index = up_to;
-      } else {
+    if constexpr (sizeof(Char) == 1) {
+      // Simply memcpy runs of ASCII characters, which are the same in UTF-8.
+      while (read_index < up_to) {
+        int ascii_length =
+            i::NonAsciiStart(read_start + read_index, up_to - read_index);
+        memcpy(current_write, read_start + read_index, ascii_length);
+        current_write += ascii_length;
+        read_index += ascii_length;
+        // Encode up to the end of the following run of non-ASCII characters.
+        // NonAsciiStart may stop early, at the start of the word containing
+        // the first non-ASCII character.
+        bool found_non_ascii = false;
         for (; read_index < up_to; read_index++) {
-          current_write += unibrow::Utf8::EncodeOneByte(
-              current_write, static_cast<uint8_t>(read_start[read_index]));
+          uint8_t character = read_start[read_index];
+          if (character > unibrow::Utf8::kMaxOneByteChar) {
+            found_non_ascii = true;
+          } else if (found_non_ascii) {
+            break;
+          }
+          current_write +=
+              unibrow::Utf8::EncodeOneByte(current_write, character);
           DCHECK(write_capacity == -1 ||
                  (current_write - write_start) <= write_capacity);
         }
@@ -7587,6 +7634,39 @@ MaybeLocal<String> v8::String::NewExternalOneByte(
   return Utils::ToLocal(string);
 }
 
+MaybeLocal<String> v8::String::NewExternalUtf8(
+    Isolate* v8_isolate, v8::String::ExternalOneByteStringResource* resource) {
+  CHECK_NOT_NULL(resource);
+  if (resource->length() > static_cast<size_t>(i::String::kMaxLength)) {
+    return MaybeLocal<String>();
+  }
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  API_RCS_SCOPE(i_isolate, String, NewExternalUtf8);
+  if (resource->length() == 0) {
+    // The resource isn't going to be used, free it immediately.
+    resource->Dispose();
+    return Utils::ToLocal(i_isolate->factory()->empty_string());
+  }
+  CHECK_NOT_NULL(resource->data());
+  base::Vector<const char> data(resource->data(),
+                                static_cast<int>(resource->length()));
+  if (i::String::IsAscii(data.begin(), data.length())) {
+    // The bytes can be used as Latin-1 characters as they are.
+    i::Handle<i::String> string = i_isolate->factory()
+                                      ->NewExternalStringFromOneByte(resource)
+                                      .ToHandleChecked();
+    return Utils::ToLocal(string);
+  }
+  i::Handle<i::String> string;
+  if (!i_isolate->factory()->NewStringFromUtf8(data).ToHandle(&string)) {
+    return MaybeLocal<String>();
+  }
+  // The decoded string has its own copy of the characters.
+  resource->Dispose();
+  return Utils::ToLocal(string);
+}
+
 bool v8::String::MakeExternal(v8::String::ExternalStringResource* resource) {
   i::DisallowGarbageCollection no_gc;
 
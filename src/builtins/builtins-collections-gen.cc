@@ -554,44 +554,67 @@ TNode<Object> BaseCollectionsAssembler::LoadAndNormalizeFixedDoubleArrayElement(
   return entry.value();
 }
 
+template <typename CollectionType>
+TNode<Uint32T> CollectionsBuiltinsAssembler::HashToOrderedHashTableTag(
+    const TNode<Uint32T> hash) {
+  // See OrderedHashTable::HashToTag().
+  return Unsigned(Word32Shr(
+      Uint32Mul(hash, Uint32Constant(CollectionType::kHashTagMultiplier)),
+      32 - CollectionType::kHashTagBits));
+}
+
 template <typename CollectionType>
 void CollectionsBuiltinsAssembler::FindOrderedHashTableEntry(
     const TNode<CollectionType> table, const TNode<Uint32T> hash,
     const std::function<void(TNode<Object>, Label*, Label*)>& key_compare,
     TVariable<IntPtrT>* entry_start_position, Label* entry_found,
     Label* not_found) {
-  // Get the index of the bucket.
-  const TNode<Uint32T> number_of_buckets =
-      PositiveSmiToUint32(CAST(UnsafeLoadFixedArrayElement(
+  // Get the index of the first bucket to probe.
+  const TNode<IntPtrT> number_of_buckets =
+      PositiveSmiUntag(CAST(UnsafeLoadFixedArrayElement(
           table, CollectionType::NumberOfBucketsIndex())));
-  const TNode<Uint32T> bucket =
-      Word32And(hash, Uint32Sub(number_of_buckets, Uint32Constant(1)));
-  const TNode<IntPtrT> first_entry = SmiUntag(CAST(UnsafeLoadFixedArrayElement(
-      table, Signed(ChangeUint32ToWord(bucket)),
-      CollectionType::HashTableStartIndex() * kTaggedSize)));
-  const TNode<IntPtrT> number_of_buckets_intptr =
-      Signed(ChangeUint32ToWord(number_of_buckets));
-
-  // Walk the bucket chain.
+  const TNode<IntPtrT> bucket_mask =
+      IntPtrSub(number_of_buckets, IntPtrConstant(1));
+  const TNode<IntPtrT> first_bucket =
+      Signed(WordAnd(ChangeUint32ToWord(hash), bucket_mask));
+  const TNode<IntPtrT> tag = Signed(
+      ChangeUint32ToWord(HashToOrderedHashTableTag<CollectionType>(hash)));
+
+  // Probe the buckets until we find the key or an empty bucket. The table is
+  // at most three quarters full, so there always is an empty bucket.
   TNode<IntPtrT> entry_start;
   Label if_key_found(this);
   {
-    TVARIABLE(IntPtrT, var_entry, first_entry);
-    Label loop(this, {&var_entry, entry_start_position}),
-        continue_next_entry(this);
+    TVARIABLE(IntPtrT, var_bucket, first_bucket);
+    Label loop(this, {&var_bucket, entry_start_position}),
+        continue_next_bucket(this), if_tag_matches(this);
     Goto(&loop);
     BIND(&loop);
 
-    // If the entry index is the not-found sentinel, we are done.
-    GotoIf(IntPtrEqual(var_entry.value(),
-                       IntPtrConstant(CollectionType::kNotFound)),
+    const TNode<IntPtrT> bucket_value =
+        SmiUntag(CAST(UnsafeLoadFixedArrayElement(
+            table, var_bucket.value(),
+            CollectionType::HashTableStartIndex() * kTaggedSize)));
+
+    // If the bucket is empty, the key is not in the table.
+    GotoIf(IntPtrEqual(bucket_value, IntPtrConstant(CollectionType::kNotFound)),
            not_found);
 
+    // Only look at the entry if the hash tags match.
+    Branch(IntPtrEqual(WordAnd(bucket_value,
+                               IntPtrConstant(CollectionType::kHashTagMask)),
+                       tag),
+           &if_tag_matches, &continue_next_bucket);
+
+    BIND(&if_tag_matches);
+    const TNode<IntPtrT> entry =
+        Signed(WordShr(bucket_value, CollectionType::kHashTagBits));
+
     // Make sure the entry index is within range.
     CSA_DCHECK(
         this,
         UintPtrLessThan(
-            var_entry.value(),
+            entry,
             PositiveSmiUntag(SmiAdd(
                 CAST(UnsafeLoadFixedArrayElement(
                     table, CollectionType::NumberOfElementsIndex())),
@@ -600,23 +623,18 @@ void CollectionsBuiltinsAssembler::FindOrderedHashTableEntry(
 
     // Compute the index of the entry relative to kHashTableStartIndex.
     entry_start =
-        IntPtrAdd(IntPtrMul(var_entry.value(),
-                            IntPtrConstant(CollectionType::kEntrySize)),
-                  number_of_buckets_intptr);
+        IntPtrAdd(IntPtrMul(entry, IntPtrConstant(CollectionType::kEntrySize)),
+                  number_of_buckets);
 
     // Load the key from the entry.
     const TNode<Object> candidate_key =
         UnsafeLoadKeyFromOrderedHashTableEntry(table, entry_start);
 
-    key_compare(candidate_key, &if_key_found, &continue_next_entry);
-
-    BIND(&continue_next_entry);
-    // Load the index of the next entry in the bucket chain.
-    var_entry = SmiUntag(CAST(UnsafeLoadFixedArrayElement(
-        table, entry_start,
-        (CollectionType::HashTableStartIndex() + CollectionType::kChainOffset) *
-            kTaggedSize)));
+    key_compare(candidate_key, &if_key_found, &continue_next_bucket);
 
+    BIND(&continue_next_bucket);
+    var_bucket = Signed(
+        WordAnd(IntPtrAdd(var_bucket.value(), IntPtrConstant(1)), bucket_mask));
     Goto(&loop);
   }
 
@@ -742,8 +760,7 @@ TNode<HeapObject> CollectionsBuiltinsAssembler::AllocateTable(
     return AllocateOrderedHashMap();
   } else {
     DCHECK_EQ(variant, kSet);
-    TNode<IntPtrT> capacity = HashTableComputeCapacity(at_least_space_for);
-    return AllocateOrderedHashSet(capacity);
+    return AllocateOrderedHashSet(at_least_space_for);
   }
 }
 
@@ -1685,8 +1702,8 @@ TNode<CollectionType> CollectionsBuiltinsAssembler::AddToOrderedHashTable(
     number_of_buckets = PositiveSmiUntag(CAST(UnsafeLoadFixedArrayElement(
         table, CollectionType::NumberOfBucketsIndex())));
 
-    static_assert(CollectionType::kLoadFactor == 2);
-    const TNode<WordT> capacity = WordShl(number_of_buckets.value(), 1);
+    const TNode<IntPtrT> capacity =
+        OrderedHashTableCapacityForBuckets(number_of_buckets.value());
     const TNode<IntPtrT> number_of_elements =
         LoadAndUntagPositiveSmiObjectField(
             table, CollectionType::NumberOfElementsOffset());
@@ -1763,26 +1780,40 @@ void CollectionsBuiltinsAssembler::StoreOrderedHashTableNewEntry(
     const TNode<CollectionType> table, const TNode<IntPtrT> hash,
     const TNode<IntPtrT> number_of_buckets, const TNode<IntPtrT> occupancy,
     const StoreAtEntry<CollectionType>& store_at_new_entry) {
-  const TNode<IntPtrT> bucket =
-      WordAnd(hash, IntPtrSub(number_of_buckets, IntPtrConstant(1)));
-  TNode<Smi> bucket_entry = CAST(UnsafeLoadFixedArrayElement(
-      table, bucket, CollectionType::HashTableStartIndex() * kTaggedSize));
-
   // Store the entry elements.
   const TNode<IntPtrT> entry_start = IntPtrAdd(
       IntPtrMul(occupancy, IntPtrConstant(CollectionType::kEntrySize)),
       number_of_buckets);
   store_at_new_entry(table, entry_start);
 
-  // Connect the element to the bucket chain.
-  UnsafeStoreFixedArrayElement(
-      table, entry_start, bucket_entry,
-      kTaggedSize * (CollectionType::HashTableStartIndex() +
-                     CollectionType::kChainOffset));
+  // Find the first empty bucket, starting at the bucket selected by {hash}.
+  // The table is at most three quarters full, so there always is one.
+  const TNode<IntPtrT> bucket_mask =
+      IntPtrSub(number_of_buckets, IntPtrConstant(1));
+  TVARIABLE(IntPtrT, var_bucket, Signed(WordAnd(hash, bucket_mask)));
+  Label loop(this, &var_bucket), found_empty_bucket(this);
+  Goto(&loop);
+  BIND(&loop);
+  {
+    const TNode<Smi> bucket_value = CAST(UnsafeLoadFixedArrayElement(
+        table, var_bucket.value(),
+        CollectionType::HashTableStartIndex() * kTaggedSize));
+    GotoIf(TaggedEqual(bucket_value, SmiConstant(CollectionType::kNotFound)),
+           &found_empty_bucket);
+    var_bucket = Signed(
+        WordAnd(IntPtrAdd(var_bucket.value(), IntPtrConstant(1)), bucket_mask));
+    Goto(&loop);
+  }
 
-  // Update the bucket head.
+  // Store the entry index and the hash tag in the bucket.
+  BIND(&found_empty_bucket);
+  const TNode<IntPtrT> tag =
+      Signed(ChangeUint32ToWord(HashToOrderedHashTableTag<CollectionType>(
+          Unsigned(TruncateIntPtrToInt32(hash)))));
+  const TNode<IntPtrT> bucket_value = WordOr(
+      Signed(WordShl(occupancy, CollectionType::kHashTagBits)), tag);
   UnsafeStoreFixedArrayElement(
-      table, bucket, SmiTag(occupancy),
+      table, var_bucket.value(), SmiTag(bucket_value),
       CollectionType::HashTableStartIndex() * kTaggedSize);
 
   // Bump the elements count.
@@ -1908,13 +1939,14 @@ TF_BUILTIN(MapPrototypeDelete, CollectionsBuiltinsAssembler) {
       table, OrderedHashMap::NumberOfDeletedElementsOffset(),
       number_of_deleted);
 
-  const TNode<Smi> number_of_buckets = CAST(
-      LoadFixedArrayElement(table, OrderedHashMap::NumberOfBucketsIndex()));
+  const TNode<IntPtrT> capacity = OrderedHashTableCapacityForBuckets(
+      PositiveSmiUntag(CAST(LoadFixedArrayElement(
+          table, OrderedHashMap::NumberOfBucketsIndex()))));
 
-  // If there fewer elements than #buckets / 2, shrink the table.
+  // If there fewer elements than capacity / 4, shrink the table.
   Label shrink(this);
-  GotoIf(SmiLessThan(SmiAdd(number_of_elements, number_of_elements),
-                     number_of_buckets),
+  GotoIf(IntPtrLessThan(SmiUntag(number_of_elements),
+                        Signed(WordShr(capacity, 2))),
          &shrink);
   Return(TrueConstant());
 
@@ -2028,13 +2060,14 @@ TF_BUILTIN(SetPrototypeDelete, CollectionsBuiltinsAssembler) {
   const TNode<Smi> number_of_elements =
       DeleteFromSetTable(context, table, key, &not_found);
 
-  const TNode<Smi> number_of_buckets = CAST(
-      LoadFixedArrayElement(table, OrderedHashSet::NumberOfBucketsIndex()));
+  const TNode<IntPtrT> capacity = OrderedHashTableCapacityForBuckets(
+      PositiveSmiUntag(CAST(LoadFixedArrayElement(
+          table, OrderedHashSet::NumberOfBucketsIndex()))));
 
-  // If there fewer elements than #buckets / 2, shrink the table.
+  // If there fewer elements than capacity / 4, shrink the table.
   Label shrink(this);
-  GotoIf(SmiLessThan(SmiAdd(number_of_elements, number_of_elements),
-                     number_of_buckets),
+  GotoIf(IntPtrLessThan(SmiUntag(number_of_elements),
+                        Signed(WordShr(capacity, 2))),
          &shrink);
   Return(TrueConstant());
 
@@ -399,8 +399,8 @@ class CollectionsBuiltinsAssembler : public BaseCollectionsAssembler {
                                              store_at_new_entry);
   }
 
-  // Generates code to store a new entry into {table}, connecting to the bucket
-  // chain, and updating the bucket head. {store_new_entry} is called to
+  // Generates code to store a new entry into {table}, and to store its index
+  // in the first empty bucket for {hash}. {store_new_entry} is called to
   // generate the code to store the payload (e.g., the key and value for
   // OrderedHashMap).
   template <typename CollectionType>
@@ -409,8 +409,8 @@ class CollectionsBuiltinsAssembler : public BaseCollectionsAssembler {
       const TNode<IntPtrT> number_of_buckets, const TNode<IntPtrT> occupancy,
       const StoreAtEntry<CollectionType>& store_at_new_entry);
 
-  // Store payload (key, value, or both) in {table} at {entry}. Does not connect
-  // the bucket chain and update the bucket head.
+  // Store payload (key, value, or both) in {table} at {entry}. Does not store
+  // the entry in a bucket.
   void StoreValueInOrderedHashMapEntry(
       const TNode<OrderedHashMap> table, const TNode<Object> value,
       const TNode<IntPtrT> entry,
@@ -496,6 +496,11 @@ class CollectionsBuiltinsAssembler : public BaseCollectionsAssembler {
       TVariable<IntPtrT>* entry_start_position, Label* entry_found,
       Label* not_found);
 
+  // Returns the hash tag that OrderedHashTable buckets store next to the
+  // entry index, see OrderedHashTable::HashToTag().
+  template <typename CollectionType>
+  TNode<Uint32T> HashToOrderedHashTableTag(const TNode<Uint32T> hash);
+
   TNode<Word32T> ComputeUnseededHash(TNode<IntPtrT> key);
 };
 
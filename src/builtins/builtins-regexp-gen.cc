@@ -466,6 +466,25 @@ TNode<HeapObject> RegExpBuiltinsAssembler::RegExpExecInternal(
            &runtime);
   }
 
+  // Skip ahead to the first occurrence of the literal that every match starts
+  // with, if there is one. The string search is considerably faster than
+  // scanning for a match start in the irregexp code.
+  TVARIABLE(IntPtrT, var_last_index, int_last_index);
+  {
+    Label next(this);
+    TNode<Object> prefilter = UnsafeLoadFixedArrayElement(
+        data, JSRegExp::kIrregexpPrefilterIndex);
+    GotoIf(TaggedIsSmi(prefilter), &next);
+    TNode<Smi> match_from =
+        CAST(CallBuiltin(Builtin::kStringIndexOf, context, string, prefilter,
+                         SmiTag(int_last_index)));
+    GotoIf(SmiEqual(match_from, SmiConstant(-1)), &if_failure);
+    var_last_index = SmiUntag(match_from);
+    Goto(&next);
+
+    BIND(&next);
+  }
+
   // Unpack the string if possible.
 
   to_direct.TryToDirect(&runtime);
@@ -487,9 +506,10 @@ TNode<HeapObject> RegExpBuiltinsAssembler::RegExpExecInternal(
 
     BIND(&if_isonebyte);
     {
-      GetStringPointers(direct_string_data, to_direct.offset(), int_last_index,
-                        int_string_length, String::ONE_BYTE_ENCODING,
-                        &var_string_start, &var_string_end);
+      GetStringPointers(direct_string_data, to_direct.offset(),
+                        var_last_index.value(), int_string_length,
+                        String::ONE_BYTE_ENCODING, &var_string_start,
+                        &var_string_end);
       var_code =
           UnsafeLoadFixedArrayElement(data, JSRegExp::kIrregexpLatin1CodeIndex);
       var_bytecode = UnsafeLoadFixedArrayElement(
@@ -499,9 +519,10 @@ TNode<HeapObject> RegExpBuiltinsAssembler::RegExpExecInternal(
 
     BIND(&if_istwobyte);
     {
-      GetStringPointers(direct_string_data, to_direct.offset(), int_last_index,
-                        int_string_length, String::TWO_BYTE_ENCODING,
-                        &var_string_start, &var_string_end);
+      GetStringPointers(direct_string_data, to_direct.offset(),
+                        var_last_index.value(), int_string_length,
+                        String::TWO_BYTE_ENCODING, &var_string_start,
+                        &var_string_end);
       var_code =
           UnsafeLoadFixedArrayElement(data, JSRegExp::kIrregexpUC16CodeIndex);
       var_bytecode = UnsafeLoadFixedArrayElement(
@@ -550,7 +571,7 @@ TNode<HeapObject> RegExpBuiltinsAssembler::RegExpExecInternal(
 
     // Argument 1: Previous index.
     MachineType arg1_type = type_int32;
-    TNode<Int32T> arg1 = TruncateIntPtrToInt32(int_last_index);
+    TNode<Int32T> arg1 = TruncateIntPtrToInt32(var_last_index.value());
 
     // Argument 2: Start of string data. This argument is ignored in the
     // interpreter.
@@ -125,6 +125,20 @@ TNode<IntPtrT> StringBuiltinsAssembler::SearchOneByteInOneByteString(
                          start_position);
       });
 }
+TNode<IntPtrT> StringBuiltinsAssembler::SearchStringInRope(
+    const TNode<ConsString> subject, const TNode<String> search,
+    const TNode<IntPtrT> start_position) {
+  const TNode<ExternalReference> function_addr =
+      ExternalConstant(ExternalReference::search_string_in_rope());
+  const TNode<ExternalReference> isolate_ptr =
+      ExternalConstant(ExternalReference::isolate_address(isolate()));
+  return UncheckedCast<IntPtrT>(
+      CallCFunction(function_addr, MachineType::IntPtr(),
+                    std::make_pair(MachineType::Pointer(), isolate_ptr),
+                    std::make_pair(MachineType::AnyTagged(), subject),
+                    std::make_pair(MachineType::AnyTagged(), search),
+                    std::make_pair(MachineType::IntPtr(), start_position)));
+}
 
 void StringBuiltinsAssembler::GenerateStringEqual(TNode<String> left,
                                                   TNode<String> right,
@@ -678,6 +692,203 @@ TF_BUILTIN(StringAdd_CheckNone, StringBuiltinsAssembler) {
   Return(StringAdd(context, left, right));
 }
 
+TNode<String> StringBuiltinsAssembler::StringBuilderConcat(
+    TNode<ContextOrEmptyContext> context, TNode<String> left,
+    TNode<String> right, TNode<String> start) {
+  CSA_DCHECK(this, IsZeroOrContext(context));
+
+  TVARIABLE(String, result);
+  Label new_backing_store(this), string_add(this), done(this, &result);
+
+  const TNode<Uint32T> left_length = LoadStringLengthAsWord32(left);
+  const TNode<Uint32T> right_length = LoadStringLengthAsWord32(right);
+  const TNode<Uint32T> new_length = Uint32Add(left_length, right_length);
+  // Short strings are copied rather than sliced, and StringAdd throws if the
+  // result is too long.
+  GotoIf(Uint32LessThan(new_length, Uint32Constant(SlicedString::kMinLength)),
+         &string_add);
+  GotoIf(Uint32GreaterThan(new_length, Uint32Constant(String::kMaxLength)),
+         &string_add);
+  const TNode<IntPtrT> word_left_length =
+      Signed(ChangeUint32ToWord(left_length));
+  const TNode<IntPtrT> word_right_length =
+      Signed(ChangeUint32ToWord(right_length));
+
+  ToDirectStringAssembler right_to_direct(state(), right);
+  right_to_direct.TryToDirect(&string_add);
+  const TNode<BoolT> right_is_one_byte =
+      IsOneByteStringInstanceType(right_to_direct.instance_type());
+
+  // Append in place if {left} is the end of a string builder and its backing
+  // store has room for {right}.
+  GotoIf(TaggedEqual(left, start), &new_backing_store);
+  const TNode<Int32T> left_instance_type = LoadInstanceType(left);
+  GotoIfNot(Word32Equal(Word32And(left_instance_type,
+                                  Int32Constant(kStringRepresentationMask)),
+                        Int32Constant(kSlicedStringTag)),
+            &new_backing_store);
+  GotoIfNot(TaggedEqual(LoadObjectField(left, offsetof(SlicedString, offset_)),
+                        SmiConstant(0)),
+            &new_backing_store);
+  const TNode<String> backing_store =
+      LoadObjectField<String>(left, offsetof(SlicedString, parent_));
+  const TNode<Int32T> backing_store_instance_type =
+      LoadInstanceType(backing_store);
+  GotoIfNot(IsSequentialStringInstanceType(backing_store_instance_type),
+            &new_backing_store);
+  GotoIf(Uint32GreaterThan(new_length,
+                           LoadStringLengthAsWord32(backing_store)),
+         &new_backing_store);
+
+  Label append_two_byte(this);
+  GotoIfNot(IsOneByteStringInstanceType(backing_store_instance_type),
+            &append_two_byte);
+  GotoIfNot(right_is_one_byte, &new_backing_store);
+  CopyDirectStringCharacters(&right_to_direct, word_right_length,
+                             backing_store, word_left_length,
+                             String::ONE_BYTE_ENCODING, &string_add);
+  result =
+      AllocateSlicedOneByteString(new_length, backing_store, SmiConstant(0));
+  Goto(&done);
+
+  BIND(&append_two_byte);
+  CopyDirectStringCharacters(&right_to_direct, word_right_length,
+                             backing_store, word_left_length,
+                             String::TWO_BYTE_ENCODING, &string_add);
+  result =
+      AllocateSlicedTwoByteString(new_length, backing_store, SmiConstant(0));
+  Goto(&done);
+
+  BIND(&new_backing_store);
+  {
+    ToDirectStringAssembler left_to_direct(state(), left);
+    left_to_direct.TryToDirect(&string_add);
+
+    // Leave room for as many characters as there are already, so that the
+    // total cost of copying stays linear in the length of the result.
+    const TNode<Uint32T> capacity = Select<Uint32T>(
+        Uint32LessThanOrEqual(new_length,
+                              Uint32Constant(String::kMaxLength / 2)),
+        [=] { return Unsigned(Word32Shl(new_length, Int32Constant(1))); },
+        [=] { return Uint32Constant(String::kMaxLength); });
+    const TNode<IntPtrT> word_capacity = Signed(ChangeUint32ToWord(capacity));
+    const TNode<IntPtrT> word_new_length =
+        IntPtrAdd(word_left_length, word_right_length);
+
+    Label two_byte(this);
+    GotoIfNot(IsOneByteStringInstanceType(left_to_direct.instance_type()),
+              &two_byte);
+    GotoIfNot(right_is_one_byte, &two_byte);
+    {
+      const TNode<String> new_backing_store =
+          AllocateSeqOneByteString(capacity);
+      FillSeqStringWithZeros(new_backing_store, word_new_length, word_capacity,
+                             String::ONE_BYTE_ENCODING);
+      CopyDirectStringCharacters(&left_to_direct, word_left_length,
+                                 new_backing_store, IntPtrConstant(0),
+                                 String::ONE_BYTE_ENCODING, &string_add);
+      CopyDirectStringCharacters(&right_to_direct, word_right_length,
+                                 new_backing_store, word_left_length,
+                                 String::ONE_BYTE_ENCODING, &string_add);
+      result = AllocateSlicedOneByteString(new_length, new_backing_store,
+                                           SmiConstant(0));
+      Goto(&done);
+    }
+
+    BIND(&two_byte);
+    {
+      const TNode<String> new_backing_store =
+          AllocateSeqTwoByteString(capacity);
+      FillSeqStringWithZeros(new_backing_store, word_new_length, word_capacity,
+                             String::TWO_BYTE_ENCODING);
+      CopyDirectStringCharacters(&left_to_direct, word_left_length,
+                                 new_backing_store, IntPtrConstant(0),
+                                 String::TWO_BYTE_ENCODING, &string_add);
+      CopyDirectStringCharacters(&right_to_direct, word_right_length,
+                                 new_backing_store, word_left_length,
+                                 String::TWO_BYTE_ENCODING, &string_add);
+      result = AllocateSlicedTwoByteString(new_length, new_backing_store,
+                                           SmiConstant(0));
+      Goto(&done);
+    }
+  }
+
+  BIND(&string_add);
+  {
+    result = StringAdd(context, left, right);
+    Goto(&done);
+  }
+
+  BIND(&done);
+  return result.value();
+}
+
+void StringBuiltinsAssembler::FillSeqStringWithZeros(
+    TNode<String> string, TNode<IntPtrT> from_index, TNode<IntPtrT> to_index,
+    String::Encoding encoding) {
+  CSA_DCHECK(this, IntPtrLessThanOrEqual(from_index, to_index));
+  static_assert(OFFSET_OF_DATA_START(SeqOneByteString) ==
+                OFFSET_OF_DATA_START(SeqTwoByteString));
+  const int char_size =
+      encoding == String::ONE_BYTE_ENCODING ? kCharSize : kUInt16Size;
+  const TNode<IntPtrT> start = IntPtrAdd(
+      BitcastTaggedToWord(string),
+      IntPtrAdd(IntPtrMul(from_index, IntPtrConstant(char_size)),
+                IntPtrConstant(OFFSET_OF_DATA_START(SeqOneByteString) -
+                               kHeapObjectTag)));
+  const TNode<IntPtrT> byte_length =
+      IntPtrMul(IntPtrSub(to_index, from_index), IntPtrConstant(char_size));
+
+  TNode<ExternalReference> memset =
+      ExternalConstant(ExternalReference::libc_memset_function());
+  static_assert(kSizetSize == kIntptrSize);
+  CallCFunction(memset, MachineType::Pointer(),
+                std::make_pair(MachineType::Pointer(), start),
+                std::make_pair(MachineType::IntPtr(), IntPtrConstant(0)),
+                std::make_pair(MachineType::UintPtr(), byte_length));
+}
+
+void StringBuiltinsAssembler::CopyDirectStringCharacters(
+    ToDirectStringAssembler* from, TNode<IntPtrT> character_count,
+    TNode<String> to_string, TNode<IntPtrT> to_index,
+    String::Encoding to_encoding, Label* if_bailout) {
+  // The pointer is only valid until the next allocation.
+  const TNode<RawPtrT> from_string = from->PointerToString(if_bailout);
+  if (to_encoding == String::ONE_BYTE_ENCODING) {
+    CSA_DCHECK(this, IsOneByteStringInstanceType(from->instance_type()));
+    CopyStringCharacters(from_string, to_string, from->offset(), to_index,
+                         character_count, String::ONE_BYTE_ENCODING,
+                         String::ONE_BYTE_ENCODING);
+    return;
+  }
+  Label one_byte(this), two_byte(this), done(this);
+  Branch(IsOneByteStringInstanceType(from->instance_type()), &one_byte,
+         &two_byte);
+
+  BIND(&one_byte);
+  CopyStringCharacters(from_string, to_string, from->offset(), to_index,
+                       character_count, String::ONE_BYTE_ENCODING,
+                       String::TWO_BYTE_ENCODING);
+  Goto(&done);
+
+  BIND(&two_byte);
+  CopyStringCharacters(from_string, to_string, from->offset(), to_index,
+                       character_count, String::TWO_BYTE_ENCODING,
+                       String::TWO_BYTE_ENCODING);
+  Goto(&done);
+
+  BIND(&done);
+}
+
+TF_BUILTIN(StringBuilderConcat, StringBuiltinsAssembler) {
+  auto left = Parameter<String>(Descriptor::kLeft);
+  auto right = Parameter<String>(Descriptor::kRight);
+  auto start = Parameter<String>(Descriptor::kStart);
+  TNode<ContextOrEmptyContext> context =
+      UncheckedParameter<ContextOrEmptyContext>(Descriptor::kContext);
+  Return(StringBuilderConcat(context, left, right, start));
+}
+
 TF_BUILTIN(SubString, StringBuiltinsAssembler) {
   auto string = Parameter<String>(Descriptor::kString);
   auto from = Parameter<Smi>(Descriptor::kFrom);
@@ -88,6 +88,9 @@ class StringBuiltinsAssembler : public CodeStubAssembler {
   TNode<IntPtrT> SearchOneByteInOneByteString(
       const TNode<RawPtrT> subject_ptr, const TNode<IntPtrT> subject_length,
       const TNode<RawPtrT> search_ptr, const TNode<IntPtrT> start_position);
+  TNode<IntPtrT> SearchStringInRope(const TNode<ConsString> subject,
+                                    const TNode<String> search,
+                                    const TNode<IntPtrT> start_position);
 
  protected:
   enum class StringComparison {
@@ -141,6 +144,16 @@ class StringBuiltinsAssembler : public CodeStubAssembler {
   TNode<String> StringAdd(TNode<ContextOrEmptyContext> context,
                           TNode<String> left, TNode<String> right);
 
+  // Appends |right| to |left| for strings that are built in loops (see
+  // src/compiler/turboshaft/string-builder-reducer.h). Unless |left| is the
+  // string |start| that the loop started from, it was returned by a previous
+  // call and nothing else has appended to it, so |right| can be copied in place
+  // into the over-allocated backing store of |left|. The result is a
+  // SlicedString of the backing store, or a regular string if it is short.
+  TNode<String> StringBuilderConcat(TNode<ContextOrEmptyContext> context,
+                                    TNode<String> left, TNode<String> right,
+                                    TNode<String> start);
+
   // Check if |string| is an indirect (thin or flat cons) string type that can
   // be dereferenced by DerefIndirectString.
   void BranchIfCanDerefIndirectString(TNode<String> string,
@@ -190,6 +203,22 @@ class StringBuiltinsAssembler : public CodeStubAssembler {
       const NodeFunction0& regexp_call, const NodeFunction1& generic_call);
 
  private:
+  // Sets the characters of the sequential string |string| from |from_index| up
+  // to |to_index| to zero.
+  void FillSeqStringWithZeros(TNode<String> string, TNode<IntPtrT> from_index,
+                              TNode<IntPtrT> to_index,
+                              String::Encoding encoding);
+
+  // Copies all |character_count| characters of the direct string |from| to
+  // |to_string|, starting at |to_index|. |to_encoding| can only be one-byte if
+  // |from| is one-byte. Jumps to |if_bailout| for uncached external strings.
+  void CopyDirectStringCharacters(ToDirectStringAssembler* from,
+                                  TNode<IntPtrT> character_count,
+                                  TNode<String> to_string,
+                                  TNode<IntPtrT> to_index,
+                                  String::Encoding to_encoding,
+                                  Label* if_bailout);
+
   template <typename T>
   TNode<String> AllocAndCopyStringCharacters(TNode<T> from,
                                              TNode<Int32T> from_instance_type,
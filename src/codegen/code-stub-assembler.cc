@@ -4328,16 +4328,25 @@ TNode<NameDictionary> CodeStubAssembler::CopyNameDictionary(
 template <typename CollectionType>
 TNode<CollectionType> CodeStubAssembler::AllocateOrderedHashTable(
     TNode<IntPtrT> capacity) {
-  capacity = IntPtrRoundUpToPowerOfTwo32(capacity);
   capacity =
       IntPtrMax(capacity, IntPtrConstant(CollectionType::kInitialCapacity));
   return AllocateOrderedHashTableWithCapacity<CollectionType>(capacity);
 }
 
+TNode<IntPtrT> CodeStubAssembler::OrderedHashTableCapacityForBuckets(
+    TNode<IntPtrT> number_of_buckets) {
+  // See OrderedHashTable::CapacityForBuckets().
+  static_assert(OrderedHashSet::MaxCapacity() == OrderedHashMap::MaxCapacity());
+  static_assert(OrderedNameDictionary::MaxCapacity() ==
+                OrderedHashMap::MaxCapacity());
+  return IntPtrMin(
+      IntPtrSub(number_of_buckets, Signed(WordShr(number_of_buckets, 2))),
+      IntPtrConstant(OrderedHashMap::MaxCapacity()));
+}
+
 template <typename CollectionType>
 TNode<CollectionType> CodeStubAssembler::AllocateOrderedHashTableWithCapacity(
     TNode<IntPtrT> capacity) {
-  CSA_DCHECK(this, WordIsPowerOfTwo(capacity));
   CSA_DCHECK(this,
              IntPtrGreaterThanOrEqual(
                  capacity, IntPtrConstant(CollectionType::kInitialCapacity)));
@@ -4345,8 +4354,24 @@ TNode<CollectionType> CodeStubAssembler::AllocateOrderedHashTableWithCapacity(
              IntPtrLessThanOrEqual(
                  capacity, IntPtrConstant(CollectionType::MaxCapacity())));
 
-  static_assert(CollectionType::kLoadFactor == 2);
-  TNode<IntPtrT> bucket_count = Signed(WordShr(capacity, IntPtrConstant(1)));
+  // Pick the smallest power of two number of buckets that leaves room for
+  // {capacity} entries, see OrderedHashTable::Allocate().
+  intptr_t const_capacity;
+  const bool is_initial_capacity =
+      TryToIntPtrConstant(capacity, &const_capacity) &&
+      const_capacity == CollectionType::kInitialCapacity;
+  TNode<IntPtrT> bucket_count;
+  if (is_initial_capacity) {
+    bucket_count = IntPtrConstant(CollectionType::kInitialNumberOfBuckets);
+  } else {
+    TNode<IntPtrT> rounded_capacity = IntPtrRoundUpToPowerOfTwo32(capacity);
+    bucket_count = Select<IntPtrT>(
+        IntPtrLessThan(OrderedHashTableCapacityForBuckets(rounded_capacity),
+                       capacity),
+        [=] { return Signed(WordShl(rounded_capacity, 1)); },
+        [=] { return rounded_capacity; });
+  }
+  capacity = OrderedHashTableCapacityForBuckets(bucket_count);
   TNode<IntPtrT> data_table_length =
       IntPtrMul(capacity, IntPtrConstant(CollectionType::kEntrySize));
 
@@ -4380,13 +4405,10 @@ TNode<CollectionType> CodeStubAssembler::AllocateOrderedHashTableWithCapacity(
 
   TNode<Smi> not_found_sentinel = SmiConstant(CollectionType::kNotFound);
 
-  intptr_t const_capacity;
-  if (TryToIntPtrConstant(capacity, &const_capacity) &&
-      const_capacity == CollectionType::kInitialCapacity) {
-    int const_bucket_count =
-        static_cast<int>(const_capacity / CollectionType::kLoadFactor);
+  if (is_initial_capacity) {
+    int const_bucket_count = CollectionType::kInitialNumberOfBuckets;
     int const_data_table_length =
-        static_cast<int>(const_capacity * CollectionType::kEntrySize);
+        CollectionType::kInitialCapacity * CollectionType::kEntrySize;
     int const_data_table_start_index = static_cast<int>(
         CollectionType::HashTableStartIndex() + const_bucket_count);
 
@@ -4466,7 +4488,7 @@ TNode<OrderedHashSet> CodeStubAssembler::AllocateOrderedHashSet() {
 
 TNode<OrderedHashSet> CodeStubAssembler::AllocateOrderedHashSet(
     TNode<IntPtrT> capacity) {
-  return AllocateOrderedHashTableWithCapacity<OrderedHashSet>(capacity);
+  return AllocateOrderedHashTable<OrderedHashSet>(capacity);
 }
 
 TNode<OrderedHashMap> CodeStubAssembler::AllocateOrderedHashMap() {
@@ -11409,16 +11431,23 @@ TNode<Object> CodeStubAssembler::GetInterestingProperty(
           LoadObjectField(holder, JSObject::kPropertiesOrHashOffset);
       CSA_DCHECK(this, TaggedIsNotSmi(properties));
       CSA_DCHECK(this, IsPropertyDictionary(CAST(properties)));
-      // TODO(pthier): Support swiss dictionaries.
-      if constexpr (!V8_ENABLE_SWISS_NAME_DICTIONARY_BOOL) {
+      if constexpr (V8_ENABLE_SWISS_NAME_DICTIONARY_BOOL) {
+        // Swiss dictionaries don't track interesting properties, so look for
+        // {name} itself.
+        TVARIABLE(IntPtrT, var_entry);
+        Label not_found(this);
+        SwissNameDictionaryFindEntry(CAST(properties), name, &lookup,
+                                     &var_entry, &not_found);
+        BIND(&not_found);
+      } else {
         TNode<Smi> flags =
             GetNameDictionaryFlags<NameDictionary>(CAST(properties));
         GotoIf(IsSetSmi(flags,
                         NameDictionary::MayHaveInterestingPropertiesBit::kMask),
                &lookup);
-        *var_holder = LoadMapPrototype(holder_map);
-        *var_holder_map = LoadMap((*var_holder).value());
       }
+      *var_holder = LoadMapPrototype(holder_map);
+      *var_holder_map = LoadMap((*var_holder).value());
       Goto(&loop);
     }
   }
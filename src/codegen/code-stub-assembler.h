@@ -2296,6 +2296,11 @@ class V8_EXPORT_PRIVATE CodeStubAssembler
 
   TNode<OrderedHashMap> AllocateOrderedHashMap();
 
+  // Returns the capacity of an OrderedHashTable with {number_of_buckets}
+  // buckets, see OrderedHashTable::CapacityForBuckets().
+  TNode<IntPtrT> OrderedHashTableCapacityForBuckets(
+      TNode<IntPtrT> number_of_buckets);
+
   // Allocates an OrderedNameDictionary of the given capacity. This guarantees
   // that |capacity| entries can be added without reallocating.
   TNode<OrderedNameDictionary> AllocateOrderedNameDictionary(
@@ -4790,7 +4795,8 @@ class V8_EXPORT_PRIVATE CodeStubAssembler
   template <typename CollectionType>
   TNode<CollectionType> AllocateOrderedHashTable(TNode<IntPtrT> capacity);
 
-  // Uses the provided capacity (which must be valid) in verbatim.
+  // Allocates a table with room for at least {capacity} entries, which must
+  // be between kInitialCapacity and MaxCapacity().
   template <typename CollectionType>
   TNode<CollectionType> AllocateOrderedHashTableWithCapacity(
       TNode<IntPtrT> capacity);
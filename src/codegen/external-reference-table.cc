@@ -294,12 +294,10 @@ void ExternalReferenceTable::AddStubCache(Isolate* isolate, int* index) {
                                         isolate->define_own_stub_cache()};
 
   for (StubCache* stub_cache : stub_caches) {
-    Add(stub_cache->key_reference(StubCache::kPrimary).address(), index);
-    Add(stub_cache->value_reference(StubCache::kPrimary).address(), index);
-    Add(stub_cache->map_reference(StubCache::kPrimary).address(), index);
-    Add(stub_cache->key_reference(StubCache::kSecondary).address(), index);
-    Add(stub_cache->value_reference(StubCache::kSecondary).address(), index);
-    Add(stub_cache->map_reference(StubCache::kSecondary).address(), index);
+    Add(stub_cache->table_reference(StubCache::kPrimary).address(), index);
+    Add(stub_cache->mask_reference(StubCache::kPrimary).address(), index);
+    Add(stub_cache->table_reference(StubCache::kSecondary).address(), index);
+    Add(stub_cache->mask_reference(StubCache::kSecondary).address(), index);
   }
 
   CHECK_EQ(kSizeIsolateIndependent + kExternalReferenceCountIsolateDependent +
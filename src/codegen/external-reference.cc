@@ -1100,6 +1100,8 @@ ExternalReference ExternalReference::search_string_raw_two_two() {
   return search_string_raw<const base::uc16, const base::uc16>();
 }
 
+FUNCTION_REFERENCE(search_string_in_rope, String::IndexOfInRopeRaw)
+
 ExternalReference
 ExternalReference::typed_array_and_rab_gsab_typed_array_elements_kind_shifts() {
   uint8_t* ptr =
@@ -228,6 +228,7 @@ class StatsCounter;
   V(search_string_raw_one_two, "search_string_raw_one_two")                    \
   V(search_string_raw_two_one, "search_string_raw_two_one")                    \
   V(search_string_raw_two_two, "search_string_raw_two_two")                    \
+  V(search_string_in_rope, "String::IndexOfInRopeRaw")                         \
   V(string_write_to_flat_one_byte, "string_write_to_flat_one_byte")            \
   V(string_write_to_flat_two_byte, "string_write_to_flat_two_byte")            \
   V(external_one_byte_string_get_chars, "external_one_byte_string_get_chars")  \
@@ -4328,6 +4328,10 @@ void InstructionSelectorT<TurbofanAdapter>::VisitNode(Node* node) {
       return MarkAsSimd256(node), VisitF32x8Neg(node);
     case IrOpcode::kF32x8Sqrt:
       return MarkAsSimd256(node), VisitF32x8Sqrt(node);
+    case IrOpcode::kF64x4Abs:
+      return MarkAsSimd256(node), VisitF64x4Abs(node);
+    case IrOpcode::kF64x4Neg:
+      return MarkAsSimd256(node), VisitF64x4Neg(node);
     case IrOpcode::kF64x4Sqrt:
       return MarkAsSimd256(node), VisitF64x4Sqrt(node);
     case IrOpcode::kI32x8Abs:
@@ -5754,10 +5754,12 @@ VISIT_ATOMIC_BINOP(Xor)
   V(I16x8AllTrue, IAllTrue, kL16, kV128)          \
   V(I8x16AllTrue, IAllTrue, kL8, kV128)           \
   V(S128Not, SNot, kL8, kV128)                    \
+  V(F64x4Abs, FAbs, kL64, kV256)                  \
   V(F32x8Abs, FAbs, kL32, kV256)                  \
   V(I32x8Abs, IAbs, kL32, kV256)                  \
   V(I16x16Abs, IAbs, kL16, kV256)                 \
   V(I8x32Abs, IAbs, kL8, kV256)                   \
+  V(F64x4Neg, FNeg, kL64, kV256)                  \
   V(F32x8Neg, FNeg, kL32, kV256)                  \
   V(I32x8Neg, INeg, kL32, kV256)                  \
   V(I16x16Neg, INeg, kL16, kV256)                 \
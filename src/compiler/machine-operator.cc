@@ -580,6 +580,8 @@ std::ostream& operator<<(std::ostream& os, TruncateKind kind) {
           1)                                                                   \
   IF_WASM(V, F64x4Add, Operator::kCommutative, 2, 0, 1)                        \
   IF_WASM(V, F64x4Sqrt, Operator::kNoProperties, 1, 0, 1)                      \
+  IF_WASM(V, F64x4Abs, Operator::kNoProperties, 1, 0, 1)                       \
+  IF_WASM(V, F64x4Neg, Operator::kNoProperties, 1, 0, 1)                       \
   IF_WASM(V, F32x8Abs, Operator::kNoProperties, 1, 0, 1)                       \
   IF_WASM(V, F32x8Neg, Operator::kNoProperties, 1, 0, 1)                       \
   IF_WASM(V, F32x8Sqrt, Operator::kNoProperties, 1, 0, 1)                      \
@@ -1029,6 +1029,8 @@ class V8_EXPORT_PRIVATE MachineOperatorBuilder final
   const Operator* F64x4Max();
   const Operator* F64x4Add();
   const Operator* F64x4Sqrt();
+  const Operator* F64x4Abs();
+  const Operator* F64x4Neg();
   const Operator* F32x8Abs();
   const Operator* F32x8Neg();
   const Operator* F32x8Sqrt();
@@ -1183,6 +1183,8 @@
   V(I16x16UConvertI32x8)           \
   V(I8x32SConvertI16x16)           \
   V(I8x32UConvertI16x16)           \
+  V(F64x4Abs)                      \
+  V(F64x4Neg)                      \
   V(F32x8Abs)                      \
   V(F32x8Neg)                      \
   V(F32x8Sqrt)                     \
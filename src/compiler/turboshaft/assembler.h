@@ -3084,6 +3084,12 @@ class TurboshaftAssemblerOpInterface
     return CallBuiltin<typename BuiltinCallDescriptor::StringAdd_CheckNone>(
         isolate, context, {left, right});
   }
+  V<String> CallBuiltin_StringBuilderConcat(Isolate* isolate,
+                                            V<Context> context, V<String> left,
+                                            V<String> right, V<String> start) {
+    return CallBuiltin<typename BuiltinCallDescriptor::StringBuilderConcat>(
+        isolate, context, {left, right, start});
+  }
   V<Boolean> CallBuiltin_StringEqual(Isolate* isolate, V<String> left,
                                      V<String> right, V<WordPtr> length) {
     return CallBuiltin<typename BuiltinCallDescriptor::StringEqual>(
@@ -306,6 +306,22 @@ struct BuiltinCallDescriptor {
         base_effects.CanReadMemory().CanAllocateWithoutIdentity();
   };
 
+  struct StringBuilderConcat : public Descriptor<StringBuilderConcat> {
+    static constexpr auto kFunction = Builtin::kStringBuilderConcat;
+    using arguments_t = std::tuple<V<String>, V<String>, V<String>>;
+    using results_t = std::tuple<V<String>>;
+
+    static constexpr bool kNeedsFrameState = false;
+    static constexpr bool kNeedsContext = true;
+    static constexpr Operator::Properties kProperties =
+        Operator::kNoDeopt | Operator::kNoWrite;
+    // Besides fresh objects, this only writes to the backing store of a string
+    // builder, past the characters that any existing string refers to. These
+    // writes are thus not visible from Turboshaft either.
+    static constexpr OpEffects kEffects =
+        base_effects.CanReadMemory().CanAllocateWithoutIdentity();
+  };
+
   struct StringEqual : public Descriptor<StringEqual> {
     static constexpr auto kFunction = Builtin::kStringEqual;
     using arguments_t = std::tuple<V<String>, V<String>, V<WordPtr>>;
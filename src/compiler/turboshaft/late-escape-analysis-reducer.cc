@@ -4,6 +4,8 @@
 
 #include "src/compiler/turboshaft/late-escape-analysis-reducer.h"
 
+#include "src/base/small-vector.h"
+
 namespace v8::internal::compiler::turboshaft {
 
 void LateEscapeAnalysisAnalyzer::Run() {
@@ -54,11 +56,76 @@ void LateEscapeAnalysisAnalyzer::FindRemovableAllocations() {
 
 bool LateEscapeAnalysisAnalyzer::AllocationIsEscaping(OpIndex alloc) {
   if (alloc_uses_.find(alloc) == alloc_uses_.end()) return false;
+  bool has_loads = false;
   for (OpIndex use : alloc_uses_.at(alloc)) {
+    if (IsLoadFromAllocation(alloc, use)) {
+      has_loads = true;
+      continue;
+    }
     if (EscapesThroughUse(alloc, use)) return true;
   }
-  // We haven't found any non-store use
-  return false;
+  // We haven't found any use besides stores and loads. The allocation can be
+  // removed if all loads can be replaced by the stored values.
+  return has_loads && !TryRecordLoadReplacements(alloc);
+}
+
+bool LateEscapeAnalysisAnalyzer::IsLoadFromAllocation(
+    OpIndex alloc, OpIndex using_op_idx) const {
+  const LoadOp* load = graph_.Get(using_op_idx).TryCast<LoadOp>();
+  return load && load->base() == alloc && !load->index().valid();
+}
+
+// Tries to find, for each load from {alloc}, the single initializing store
+// whose value the load observes. This is the case if the store is the only one
+// writing to the loaded bytes, and if it is in the same block as the
+// allocation and precedes the load. Since loads are dominated by {alloc}, this
+// guarantees that the store is executed before the load. Returns false (and
+// records nothing) if any of the loads can't be replaced.
+bool LateEscapeAnalysisAnalyzer::TryRecordLoadReplacements(OpIndex alloc) {
+  const ZoneVector<OpIndex>& uses = alloc_uses_.at(alloc);
+  BlockIndex alloc_block = graph_.BlockIndexOf(alloc);
+  base::SmallVector<std::pair<OpIndex, OpIndex>, 8> replacements;
+  for (OpIndex use : uses) {
+    if (!IsLoadFromAllocation(alloc, use)) continue;
+    const LoadOp& load = graph_.Get(use).Cast<LoadOp>();
+    int32_t load_start = load.offset;
+    int32_t load_end = load_start + load.loaded_rep.SizeInBytes();
+    const StoreOp* initializing_store = nullptr;
+    OpIndex initializing_store_index;
+    for (OpIndex other_use : uses) {
+      const StoreOp* store = graph_.Get(other_use).TryCast<StoreOp>();
+      if (!store) continue;
+      // Stores with a dynamic index might write to any field.
+      if (store->index().valid()) return false;
+      if (store->kind.tagged_base != load.kind.tagged_base) return false;
+      int32_t store_start = store->offset;
+      int32_t store_end = store_start + store->stored_rep.SizeInBytes();
+      if (store_end <= load_start || load_end <= store_start) continue;
+      // Only a single store of exactly the loaded representation can be
+      // forwarded. Sub-word stores are excluded as they implicitly truncate
+      // the stored value.
+      if (initializing_store != nullptr || store_start != load_start ||
+          store->stored_rep != load.loaded_rep ||
+          store->stored_rep.SizeInBytes() < kInt32Size) {
+        return false;
+      }
+      initializing_store = store;
+      initializing_store_index = other_use;
+    }
+    if (initializing_store == nullptr) return false;
+    if (graph_.BlockIndexOf(initializing_store_index) != alloc_block) {
+      return false;
+    }
+    if (graph_.BlockIndexOf(use) == alloc_block &&
+        use < initializing_store_index) {
+      return false;
+    }
+    replacements.emplace_back(use, initializing_store->value());
+  }
+  for (auto [load, value] : replacements) {
+    load_replacements_[load] = value;
+  }
+  return true;
 }
 
 // Returns true if {using_op_idx} is an operation that forces {alloc} to be
@@ -86,8 +153,13 @@ void LateEscapeAnalysisAnalyzer::MarkToRemove(OpIndex alloc) {
     return;
   }
 
-  // The uses of {alloc} should also be skipped.
+  // The uses of {alloc} should also be skipped. Loads are not killed but
+  // replaced by the stored value (see {load_replacements_}).
   for (OpIndex use : alloc_uses_.at(alloc)) {
+    if (graph_.Get(use).Is<LoadOp>()) {
+      DCHECK(load_replacements_.contains(use));
+      continue;
+    }
     const StoreOp& store = graph_.Get(use).Cast<StoreOp>();
     if (graph_.Get(store.value()).Is<AllocateOp>()) {
       // This store was storing the result of an allocation. Because we now
@@ -14,15 +14,28 @@
 namespace v8::internal::compiler::turboshaft {
 
 // LateEscapeAnalysis removes allocation that have no uses besides the stores
-// initializing the object.
+// initializing the object, and loads that can be replaced by the value that was
+// stored by such an initializing store (scalar replacement).
 
 class LateEscapeAnalysisAnalyzer {
  public:
   LateEscapeAnalysisAnalyzer(Graph& graph, Zone* zone)
-      : graph_(graph), phase_zone_(zone), alloc_uses_(zone), allocs_(zone) {}
+      : graph_(graph),
+        phase_zone_(zone),
+        alloc_uses_(zone),
+        allocs_(zone),
+        load_replacements_(zone) {}
 
   void Run();
 
+  // Returns the value that a load from a removed allocation should be replaced
+  // with, or an invalid OpIndex if {load} is not such a load.
+  OpIndex GetLoadReplacement(OpIndex load) const {
+    auto it = load_replacements_.find(load);
+    if (it == load_replacements_.end()) return OpIndex::Invalid();
+    return it->second;
+  }
+
  private:
   void RecordAllocateUse(OpIndex alloc, OpIndex use);
 
@@ -30,6 +43,8 @@ class LateEscapeAnalysisAnalyzer {
   void FindRemovableAllocations();
   bool AllocationIsEscaping(OpIndex alloc);
   bool EscapesThroughUse(OpIndex alloc, OpIndex using_op_idx);
+  bool IsLoadFromAllocation(OpIndex alloc, OpIndex using_op_idx) const;
+  bool TryRecordLoadReplacements(OpIndex alloc);
   void MarkToRemove(OpIndex alloc);
 
   Graph& graph_;
@@ -41,6 +56,9 @@ class LateEscapeAnalysisAnalyzer {
   // iterated upon to determine which allocations can be removed and which
   // cannot.
   ZoneVector<OpIndex> allocs_;
+  // {load_replacements_} maps loads from removed allocations to the value that
+  // the corresponding initializing store wrote.
+  ZoneAbslFlatHashMap<OpIndex, OpIndex> load_replacements_;
 };
 
 template <class Next>
@@ -53,6 +71,12 @@ class LateEscapeAnalysisReducer : public Next {
     Next::Analyze();
   }
 
+  OpIndex REDUCE_INPUT_GRAPH(Load)(OpIndex ig_index, const LoadOp& load) {
+    OpIndex replacement = analyzer_.GetLoadReplacement(ig_index);
+    if (replacement.valid()) return Asm().MapToNewGraph(replacement);
+    return Next::ReduceInputGraphLoad(ig_index, load);
+  }
+
  private:
   LateEscapeAnalysisAnalyzer analyzer_{Asm().modifiable_input_graph(),
                                        Asm().phase_zone()};
@@ -12,6 +12,7 @@
 #include "src/compiler/turboshaft/machine-optimization-reducer.h"
 #include "src/compiler/turboshaft/required-optimization-reducer.h"
 #include "src/compiler/turboshaft/select-lowering-reducer.h"
+#include "src/compiler/turboshaft/string-builder-reducer.h"
 #include "src/compiler/turboshaft/variable-reducer.h"
 
 namespace v8::internal::compiler::turboshaft {
@@ -23,8 +24,8 @@ void MachineLoweringPhase::Run(PipelineData* data, Zone* temp_zone) {
   // SimplifiedLowering just yet, so I'm hijacking MachineLoweringPhase to run
   // JSGenericLoweringReducer without requiring a whole phase just for that.
   CopyingPhase<JSGenericLoweringReducer, DataViewLoweringReducer,
-               MachineLoweringReducer, FastApiCallLoweringReducer,
-               SelectLoweringReducer,
+               StringBuilderReducer, MachineLoweringReducer,
+               FastApiCallLoweringReducer, SelectLoweringReducer,
                MachineOptimizationReducer>::Run(data, temp_zone);
 }
 
@@ -2304,7 +2304,8 @@ class MachineLoweringReducer : public Next {
   }
 
   V<String> REDUCE(StringConcat)(V<String> left, V<String> right) {
-    // TODO(nicohartmann@): Port StringBuilder once it is stable.
+    // Concatenations that build strings in loops have already been lowered
+    // by StringBuilderReducer.
     return __ CallBuiltin_StringAdd_CheckNone(isolate_, __ NoContextConstant(),
                                               left, right);
   }
@@ -3133,58 +3134,68 @@ class MachineLoweringReducer : public Next {
         return __ CallBuiltin_FindOrderedHashMapEntry(
             isolate_, __ NoContextConstant(), data_structure, key);
       case FindOrderedHashEntryOp::Kind::kFindOrderedHashMapEntryForInt32Key: {
-        // Compute the integer hash code.
-        V<WordPtr> hash = __ ChangeUint32ToUintPtr(ComputeUnseededHash(key));
+        // Compute the integer hash code and its hash tag (see
+        // OrderedHashTable::HashToTag()).
+        V<Word32> hash32 = ComputeUnseededHash(key);
+        V<WordPtr> hash = __ ChangeUint32ToUintPtr(hash32);
+        V<WordPtr> tag = __ ChangeUint32ToUintPtr(__ Word32ShiftRightLogical(
+            __ Word32Mul(hash32, static_cast<int32_t>(
+                                     OrderedHashMap::kHashTagMultiplier)),
+            32 - OrderedHashMap::kHashTagBits));
 
         V<WordPtr> number_of_buckets =
             __ ChangeInt32ToIntPtr(__ UntagSmi(__ template LoadField<Smi>(
                 data_structure,
                 AccessBuilder::ForOrderedHashMapOrSetNumberOfBuckets())));
-        hash = __ WordPtrBitwiseAnd(hash, __ WordPtrSub(number_of_buckets, 1));
-        V<WordPtr> first_entry = __ ChangeInt32ToIntPtr(__ UntagSmi(__ Load(
-            data_structure,
-            __ WordPtrAdd(__ WordPtrShiftLeft(hash, kTaggedSizeLog2),
-                          OrderedHashMap::HashTableStartOffset()),
-            LoadOp::Kind::TaggedBase(), MemoryRepresentation::TaggedSigned())));
+        V<WordPtr> bucket_mask = __ WordPtrSub(number_of_buckets, 1);
+        V<WordPtr> first_bucket = __ WordPtrBitwiseAnd(hash, bucket_mask);
 
         Label<WordPtr> done(this);
         LoopLabel<WordPtr> loop(this);
-        GOTO(loop, first_entry);
-
-        BIND_LOOP(loop, entry) {
-          GOTO_IF(__ WordPtrEqual(entry, OrderedHashMap::kNotFound), done,
-                  entry);
-          V<WordPtr> candidate =
-              __ WordPtrAdd(__ WordPtrMul(entry, OrderedHashMap::kEntrySize),
-                            number_of_buckets);
-          V<Object> candidate_key = __ Load(
+        GOTO(loop, first_bucket);
+
+        BIND_LOOP(loop, bucket) {
+          V<WordPtr> bucket_value = __ ChangeInt32ToIntPtr(__ UntagSmi(__ Load(
               data_structure,
-              __ WordPtrAdd(__ WordPtrShiftLeft(candidate, kTaggedSizeLog2),
+              __ WordPtrAdd(__ WordPtrShiftLeft(bucket, kTaggedSizeLog2),
                             OrderedHashMap::HashTableStartOffset()),
-              LoadOp::Kind::TaggedBase(), MemoryRepresentation::AnyTagged());
+              LoadOp::Kind::TaggedBase(),
+              MemoryRepresentation::TaggedSigned())));
+          GOTO_IF(__ WordPtrEqual(bucket_value, OrderedHashMap::kNotFound),
+                  done, bucket_value);
+
+          IF (__ WordPtrEqual(
+                  __ WordPtrBitwiseAnd(bucket_value,
+                                       OrderedHashMap::kHashTagMask),
+                  tag)) {
+            V<WordPtr> entry = __ WordPtrShiftRightLogical(
+                bucket_value, OrderedHashMap::kHashTagBits);
+            V<WordPtr> candidate =
+                __ WordPtrAdd(__ WordPtrMul(entry, OrderedHashMap::kEntrySize),
+                              number_of_buckets);
+            V<Object> candidate_key = __ Load(
+                data_structure,
+                __ WordPtrAdd(__ WordPtrShiftLeft(candidate, kTaggedSizeLog2),
+                              OrderedHashMap::HashTableStartOffset()),
+                LoadOp::Kind::TaggedBase(), MemoryRepresentation::AnyTagged());
 
-          IF (LIKELY(__ ObjectIsSmi(candidate_key))) {
-            GOTO_IF(
-                __ Word32Equal(__ UntagSmi(V<Smi>::Cast(candidate_key)), key),
-                done, candidate);
-          } ELSE IF (__ TaggedEqual(
-                        __ LoadMapField(candidate_key),
-                        __ HeapConstant(factory_->heap_number_map()))) {
-            GOTO_IF(__ Float64Equal(
-                        __ template LoadField<Float64>(
-                            candidate_key, AccessBuilder::ForHeapNumberValue()),
-                        __ ChangeInt32ToFloat64(key)),
-                    done, candidate);
+            IF (LIKELY(__ ObjectIsSmi(candidate_key))) {
+              GOTO_IF(
+                  __ Word32Equal(__ UntagSmi(V<Smi>::Cast(candidate_key)), key),
+                  done, candidate);
+            } ELSE IF (__ TaggedEqual(
+                          __ LoadMapField(candidate_key),
+                          __ HeapConstant(factory_->heap_number_map()))) {
+              GOTO_IF(__ Float64Equal(__ template LoadField<Float64>(
+                                          candidate_key,
+                                          AccessBuilder::ForHeapNumberValue()),
+                                      __ ChangeInt32ToFloat64(key)),
+                      done, candidate);
+            }
           }
 
-          V<WordPtr> next_entry = __ ChangeInt32ToIntPtr(__ UntagSmi(__ Load(
-              data_structure,
-              __ WordPtrAdd(__ WordPtrShiftLeft(candidate, kTaggedSizeLog2),
-                            (OrderedHashMap::HashTableStartOffset() +
-                             OrderedHashMap::kChainOffset * kTaggedSize)),
-              LoadOp::Kind::TaggedBase(),
-              MemoryRepresentation::TaggedSigned())));
-          GOTO(loop, next_entry);
+          GOTO(loop,
+               __ WordPtrBitwiseAnd(__ WordPtrAdd(bucket, 1), bucket_mask));
         }
 
         BIND(done, result);
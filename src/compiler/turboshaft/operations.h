@@ -8005,6 +8005,8 @@ struct Simd256LoadTransformOp
   V(I16x16Neg)                           \
   V(I32x8Abs)                            \
   V(I32x8Neg)                            \
+  V(F64x4Abs)                            \
+  V(F64x4Neg)                            \
   V(F32x8Abs)                            \
   V(F32x8Neg)                            \
   V(F32x8Sqrt)                           \
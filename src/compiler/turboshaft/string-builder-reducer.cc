@@ -0,0 +1,86 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/turboshaft/string-builder-reducer.h"
+
+#include "src/base/small-vector.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+void StringBuilderAnalyzer::Run() {
+  for (const Block& block : graph_.blocks()) {
+    if (!block.IsLoop()) continue;
+    for (OpIndex index : graph_.OperationIndices(block)) {
+      const PhiOp* phi = graph_.Get(index).TryCast<PhiOp>();
+      if (phi == nullptr) continue;
+      VisitLoopPhi(block, index, *phi);
+    }
+  }
+}
+
+OpIndex StringBuilderAnalyzer::GetConcatLeft(const Operation& op) const {
+  if (const StringConcatOp* concat = op.TryCast<StringConcatOp>()) {
+    return concat->left();
+  }
+  if (const NewConsStringOp* cons = op.TryCast<NewConsStringOp>()) {
+    return cons->first();
+  }
+  return OpIndex::Invalid();
+}
+
+void StringBuilderAnalyzer::VisitLoopPhi(const Block& header,
+                                         OpIndex phi_index, const PhiOp& phi) {
+  if (phi.input_count != 2) return;
+  // Walk the chain of concatenations backwards, from the backedge to the phi.
+  base::SmallVector<OpIndex, 8> chain;
+  OpIndex current = phi.input(PhiOp::kLoopPhiBackEdgeIndex);
+  while (current != phi_index) {
+    OpIndex left = GetConcatLeft(graph_.Get(current));
+    if (!left.valid()) return;
+    // Only build the LoopFinder once we know that some loop builds a string.
+    if (!loop_finder_.has_value()) loop_finder_.emplace(phase_zone_, &graph_);
+    if (!IsInLoopBody(header, current)) return;
+    chain.push_back(current);
+    current = left;
+  }
+  if (chain.empty()) return;
+
+  OpIndex start = phi.input(0);
+  if (!IsComputedOutsideOfEnclosingLoops(header, start)) return;
+
+  for (OpIndex concat : chain) {
+    DCHECK(!string_builder_starts_.contains(concat));
+    string_builder_starts_[concat] = start;
+  }
+}
+
+bool StringBuilderAnalyzer::IsInLoopBody(const Block& header,
+                                         OpIndex op) const {
+  const Block* block = &graph_.Get(graph_.BlockIndexOf(op));
+  if (block == &header) return true;
+  // For loop headers, the LoopFinder returns the enclosing loop, but the
+  // header of a nested loop is executed once per iteration of that loop.
+  if (block->IsLoop()) return false;
+  return loop_finder_->GetLoopHeader(block) == &header;
+}
+
+bool StringBuilderAnalyzer::IsComputedOutsideOfEnclosingLoops(
+    const Block& header, OpIndex start) const {
+  const Block* outer_loop = loop_finder_->GetLoopHeader(&header);
+  if (outer_loop == nullptr) return true;
+  const Block* start_block = &graph_.Get(graph_.BlockIndexOf(start));
+  const Block* start_loop = start_block->IsLoop()
+                                ? start_block
+                                : loop_finder_->GetLoopHeader(start_block);
+  for (; start_loop != nullptr;
+       start_loop = loop_finder_->GetLoopHeader(start_loop)) {
+    for (const Block* loop = outer_loop; loop != nullptr;
+         loop = loop_finder_->GetLoopHeader(loop)) {
+      if (loop == start_loop) return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace v8::internal::compiler::turboshaft
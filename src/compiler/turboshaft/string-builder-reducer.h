@@ -0,0 +1,129 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_TURBOSHAFT_STRING_BUILDER_REDUCER_H_
+#define V8_COMPILER_TURBOSHAFT_STRING_BUILDER_REDUCER_H_
+
+#include "src/base/optional.h"
+#include "src/compiler/turboshaft/assembler.h"
+#include "src/compiler/turboshaft/graph.h"
+#include "src/compiler/turboshaft/loop-finder.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "src/zone/zone-containers.h"
+#include "src/zone/zone.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+#include "src/compiler/turboshaft/define-assembler-macros.inc"
+
+// StringBuilderAnalyzer finds loops that build a string by appending to it:
+//
+//    let s = "";
+//    for (...) {
+//      s += "<td>";
+//      s += x;
+//    }
+//
+// In the graph, such a loop has a loop phi whose backedge input is a chain of
+// StringConcat (or NewConsString) operations, each appending to the previous
+// one, and the first one appending to the phi itself. Lowering these to
+// ConsStrings creates one rope node per concatenation and a deep rope that has
+// to be flattened later. Instead, StringBuilderReducer lowers them to the
+// StringBuilderConcat builtin, which copies the right-hand side into an
+// over-allocated sequential backing store and returns a SlicedString of the
+// part of the backing store that has been written so far.
+//
+// Appending in place is only correct if nothing else appends to the same
+// SlicedString, or the two appends would write to the same characters. Within
+// a chain, each value is appended to at most once: the phi by the first
+// concatenation of the chain, and every other concatenation by the next one.
+// This requires that all of the concatenations are in the loop itself rather
+// than in a nested loop, where they could run several times per iteration.
+// The value that the phi starts from is not part of the string builder though
+// (it could be a SlicedString created by anyone), which is why it is passed to
+// the builtin as well, which won't append in place to it.
+class V8_EXPORT_PRIVATE StringBuilderAnalyzer {
+ public:
+  StringBuilderAnalyzer(const Graph& graph, Zone* phase_zone)
+      : graph_(graph),
+        phase_zone_(phase_zone),
+        string_builder_starts_(phase_zone) {}
+
+  void Run();
+
+  // If {concat} is part of a string builder, returns the value that the string
+  // builder starts from. Returns an invalid OpIndex otherwise.
+  OpIndex GetStringBuilderStart(OpIndex concat) const {
+    auto it = string_builder_starts_.find(concat);
+    if (it == string_builder_starts_.end()) return OpIndex::Invalid();
+    return it->second;
+  }
+
+ private:
+  void VisitLoopPhi(const Block& header, OpIndex phi_index, const PhiOp& phi);
+  // Returns the string that {op} appends to if {op} is a concatenation, or an
+  // invalid OpIndex otherwise.
+  OpIndex GetConcatLeft(const Operation& op) const;
+  bool IsInLoopBody(const Block& header, OpIndex op) const;
+  // Returns true if {start} is computed at most once per execution of the
+  // loops that contain {header}. Otherwise, each execution of the loop
+  // starting at {header} would copy a string that keeps growing.
+  bool IsComputedOutsideOfEnclosingLoops(const Block& header,
+                                         OpIndex start) const;
+
+  const Graph& graph_;
+  Zone* phase_zone_;
+  base::Optional<LoopFinder> loop_finder_;
+  // Maps concatenations that are part of a string builder to the value that
+  // the string builder starts from.
+  ZoneAbslFlatHashMap<OpIndex, OpIndex> string_builder_starts_;
+};
+
+template <class Next>
+class StringBuilderReducer : public Next {
+ public:
+  TURBOSHAFT_REDUCER_BOILERPLATE(StringBuilder)
+
+  void Analyze() {
+    if (v8_flags.turboshaft_string_builder && v8_flags.string_slices) {
+      analyzer_.Run();
+    }
+    Next::Analyze();
+  }
+
+  OpIndex REDUCE_INPUT_GRAPH(StringConcat)(OpIndex ig_index,
+                                           const StringConcatOp& op) {
+    OpIndex start = analyzer_.GetStringBuilderStart(ig_index);
+    if (start.valid()) {
+      return StringBuilderConcat(op.left(), op.right(), start);
+    }
+    return Next::ReduceInputGraphStringConcat(ig_index, op);
+  }
+
+  OpIndex REDUCE_INPUT_GRAPH(NewConsString)(OpIndex ig_index,
+                                            const NewConsStringOp& op) {
+    OpIndex start = analyzer_.GetStringBuilderStart(ig_index);
+    if (start.valid()) {
+      return StringBuilderConcat(op.first(), op.second(), start);
+    }
+    return Next::ReduceInputGraphNewConsString(ig_index, op);
+  }
+
+ private:
+  V<String> StringBuilderConcat(V<String> left, V<String> right,
+                                OpIndex start) {
+    return __ CallBuiltin_StringBuilderConcat(
+        isolate_, __ NoContextConstant(), __ MapToNewGraph(left),
+        __ MapToNewGraph(right), V<String>::Cast(__ MapToNewGraph(start)));
+  }
+
+  Isolate* isolate_ = __ data() -> isolate();
+  StringBuilderAnalyzer analyzer_{Asm().input_graph(), Asm().phase_zone()};
+};
+
+#include "src/compiler/turboshaft/undef-assembler-macros.inc"
+
+}  // namespace v8::internal::compiler::turboshaft
+
+#endif  // V8_COMPILER_TURBOSHAFT_STRING_BUILDER_REDUCER_H_
@@ -43,6 +43,8 @@ namespace v8::internal::compiler::turboshaft {
   V(I32x4Neg, I32x8Neg)                                    \
   V(F32x4Abs, F32x8Abs)                                    \
   V(F32x4Neg, F32x8Neg)                                    \
+  V(F64x2Abs, F64x4Abs)                                    \
+  V(F64x2Neg, F64x4Neg)                                    \
   V(F32x4Sqrt, F32x8Sqrt)                                  \
   V(F64x2Sqrt, F64x4Sqrt)                                  \
   V(I32x4UConvertF32x4, I32x8UConvertF32x8)                \
@@ -1961,6 +1961,9 @@ void JSRegExp::JSRegExpVerify(Isolate* isolate) {
       CHECK_EQ(arr->get(JSRegExp::kIrregexpTicksUntilTierUpIndex),
                uninitialized);
       CHECK_EQ(arr->get(JSRegExp::kIrregexpBacktrackLimit), uninitialized);
+      CHECK_EQ(arr->get(JSRegExp::kIrregexpPrefilterIndex), uninitialized);
+      Tagged<Object> dfa = arr->get(JSRegExp::kExperimentalDfaIndex);
+      CHECK(dfa == uninitialized || (is_compiled && IsForeign(dfa)));
       break;
     }
     case JSRegExp::IRREGEXP: {
@@ -2001,6 +2004,10 @@ void JSRegExp::JSRegExpVerify(Isolate* isolate) {
       CHECK(IsSmi(arr->get(JSRegExp::kIrregexpMaxRegisterCountIndex)));
       CHECK(IsSmi(arr->get(JSRegExp::kIrregexpTicksUntilTierUpIndex)));
       CHECK(IsSmi(arr->get(JSRegExp::kIrregexpBacktrackLimit)));
+      Tagged<Object> prefilter = arr->get(JSRegExp::kIrregexpPrefilterIndex);
+      CHECK((IsSmi(prefilter) &&
+             Smi::ToInt(prefilter) == JSRegExp::kUninitializedValue) ||
+            (IsString(prefilter) && String::cast(prefilter)->length() > 0));
       break;
     }
     default:
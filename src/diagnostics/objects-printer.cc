@@ -1147,9 +1147,16 @@ void PrintOrderedHashTableHeaderAndBuckets(std::ostream& os, T table,
 
   os << "\n - buckets: {";
   for (int bucket = 0; bucket < table.NumberOfBuckets(); bucket++) {
-    Tagged<Object> entry = table.get(T::HashTableStartIndex() + bucket);
-    DCHECK(IsSmi(entry));
-    os << "\n   " << std::setw(12) << bucket << ": " << Brief(entry);
+    Tagged<Object> value = table.get(T::HashTableStartIndex() + bucket);
+    DCHECK(IsSmi(value));
+    os << "\n   " << std::setw(12) << bucket << ": ";
+    int raw_value = Smi::ToInt(value);
+    if (raw_value == T::kNotFound) {
+      os << "empty";
+    } else {
+      os << "entry " << (raw_value >> T::kHashTagBits) << " (tag "
+         << (raw_value & T::kHashTagMask) << ")";
+    }
   }
   os << "\n }";
 }
@@ -72,6 +72,7 @@
 #include "src/interpreter/bytecode-array-iterator.h"
 #include "src/interpreter/bytecodes.h"
 #include "src/interpreter/interpreter.h"
+#include "src/json/json-parser.h"
 #include "src/libsampler/sampler.h"
 #include "src/logging/counters.h"
 #include "src/logging/log.h"
@@ -5635,6 +5636,17 @@ void Isolate::set_date_cache(DateCache* date_cache) {
   date_cache_ = date_cache;
 }
 
+JsonObjectShapeCache* Isolate::json_object_shape_cache() {
+  if (!json_object_shape_cache_) {
+    json_object_shape_cache_ = std::make_unique<JsonObjectShapeCache>();
+  }
+  return json_object_shape_cache_.get();
+}
+
+void Isolate::ClearJsonObjectShapeCache() {
+  if (json_object_shape_cache_) json_object_shape_cache_->Clear();
+}
+
 Isolate::KnownPrototype Isolate::IsArrayOrObjectOrStringPrototype(
     Tagged<Object> object) {
   Tagged<Object> context = heap()->native_contexts_list();
@@ -131,6 +131,7 @@ class HandleScopeImplementer;
 class HeapObjectToIndexHashMap;
 class HeapProfiler;
 class InnerPointerToCodeCache;
+class JsonObjectShapeCache;
 class LazyCompileDispatcher;
 class LocalIsolate;
 class V8FileLogger;
@@ -1391,6 +1392,11 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   void IncreaseTotalRegexpCodeGenerated(Handle<HeapObject> code);
 
   std::vector<int>* regexp_indices() { return &regexp_indices_; }
+  // Backing store for the match registers of RegExpGlobalCache, which takes
+  // ownership of it for the duration of a global match.
+  std::vector<int32_t>* regexp_global_cache_registers() {
+    return &regexp_global_cache_registers_;
+  }
 
   Debug* debug() const { return debug_; }
 
@@ -1542,6 +1548,9 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 
   void set_date_cache(DateCache* date_cache);
 
+  JsonObjectShapeCache* json_object_shape_cache();
+  void ClearJsonObjectShapeCache();
+
 #ifdef V8_INTL_SUPPORT
 
   const std::string& DefaultLocale();
@@ -2437,7 +2446,9 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 #endif  // !V8_INTL_SUPPORT
   RegExpStack* regexp_stack_ = nullptr;
   std::vector<int> regexp_indices_;
+  std::vector<int32_t> regexp_global_cache_registers_;
   DateCache* date_cache_ = nullptr;
+  std::unique_ptr<JsonObjectShapeCache> json_object_shape_cache_;
   base::RandomNumberGenerator* random_number_generator_ = nullptr;
   base::RandomNumberGenerator* fuzzer_rng_ = nullptr;
   std::atomic<RAILMode> rail_mode_;
@@ -1328,6 +1328,9 @@ DEFINE_BOOL(turboshaft_load_elimination, false,
 DEFINE_BOOL(turboshaft_loop_peeling, false, "enable Turboshaft's loop peeling")
 DEFINE_BOOL(turboshaft_loop_unrolling, false,
             "enable Turboshaft's loop unrolling")
+DEFINE_BOOL(turboshaft_string_builder, true,
+            "build strings that are appended to in loops in place rather "
+            "than as ConsStrings")
 
 DEFINE_EXPERIMENTAL_FEATURE(turboshaft_typed_optimizations,
                             "enable an additional Turboshaft phase that "
@@ -2323,6 +2326,18 @@ DEFINE_BOOL_READONLY(fast_map_update, false,
                      "enable fast map update by caching the migration target")
 DEFINE_INT(max_valid_polymorphic_map_count, 4,
            "maximum number of valid maps to track in POLYMORPHIC state")
+DEFINE_INT(max_valid_polymorphic_named_map_count, 12,
+           "maximum number of valid maps to track in POLYMORPHIC state for "
+           "property accesses by name (at least "
+           "--max-valid-polymorphic-map-count)")
+
+// stub-cache.cc
+DEFINE_BOOL(adaptive_stub_cache, true,
+            "grow the megamorphic stub cache when most updates evict a live "
+            "entry")
+DEFINE_BOOL(trace_stub_cache, false,
+            "trace updates, evictions and growth of the megamorphic stub "
+            "cache")
 
 // map-inl.h
 DEFINE_INT(fast_properties_soft_limit, 12,
@@ -2491,6 +2506,11 @@ DEFINE_NEG_IMPLICATION(regexp_interpret_all, regexp_tier_up)
 DEFINE_INT(regexp_tier_up_ticks, 1,
            "set the number of executions for the regexp interpreter before "
            "tiering-up to the compiler")
+DEFINE_BOOL(regexp_prefilter, true,
+            "skip to occurrences of a regexp's literal prefix before running "
+            "irregexp code")
+DEFINE_BOOL(regexp_shared_bytecode_cache, true,
+            "share compiled regexp bytecode between isolates")
 DEFINE_BOOL(regexp_peephole_optimization, REGEXP_PEEPHOLE_OPTIMIZATION_BOOL,
             "enable peephole optimization for regexp bytecode")
 DEFINE_BOOL(trace_regexp_peephole_optimization, false,
@@ -2510,6 +2530,14 @@ DEFINE_IMPLICATION(default_to_experimental_regexp_engine,
                    enable_experimental_regexp_engine)
 DEFINE_BOOL(trace_experimental_regexp_engine, false,
             "trace execution of experimental regexp engine")
+DEFINE_BOOL(regexp_lazy_dfa, true,
+            "use a lazily built DFA to skip hopeless searches in the "
+            "experimental regexp engine")
+DEFINE_BOOL(default_to_experimental_regexp_engine_with_dfa, false,
+            "run regexps with the experimental engine where the lazy DFA "
+            "supports them")
+DEFINE_IMPLICATION(default_to_experimental_regexp_engine_with_dfa,
+                   enable_experimental_regexp_engine)
 
 DEFINE_BOOL(enable_experimental_regexp_engine_on_excessive_backtracks, false,
             "fall back to a breadth-first regexp engine on excessive "
@@ -3950,7 +3950,8 @@ void Factory::SetRegExpAtomData(DirectHandle<JSRegExp> regexp,
 void Factory::SetRegExpIrregexpData(DirectHandle<JSRegExp> regexp,
                                     DirectHandle<String> source,
                                     JSRegExp::Flags flags, int capture_count,
-                                    uint32_t backtrack_limit) {
+                                    uint32_t backtrack_limit,
+                                    MaybeDirectHandle<String> prefilter) {
   DCHECK(Smi::IsValid(backtrack_limit));
   Tagged<FixedArray> store =
       *NewFixedArray(JSRegExp::kIrregexpDataSize, AllocationType::kYoung);
@@ -3971,6 +3972,13 @@ void Factory::SetRegExpIrregexpData(DirectHandle<JSRegExp> regexp,
   store->set(JSRegExp::kIrregexpCaptureNameMapIndex, uninitialized);
   store->set(JSRegExp::kIrregexpTicksUntilTierUpIndex, ticks_until_tier_up);
   store->set(JSRegExp::kIrregexpBacktrackLimit, Smi::FromInt(backtrack_limit));
+  DirectHandle<String> prefilter_string;
+  if (prefilter.ToHandle(&prefilter_string)) {
+    store->set(JSRegExp::kIrregexpPrefilterIndex, *prefilter_string,
+               SKIP_WRITE_BARRIER);
+  } else {
+    store->set(JSRegExp::kIrregexpPrefilterIndex, uninitialized);
+  }
   regexp->set_data(store);
 }
 
@@ -3995,6 +4003,8 @@ void Factory::SetRegExpExperimentalData(DirectHandle<JSRegExp> regexp,
   store->set(JSRegExp::kIrregexpCaptureNameMapIndex, uninitialized);
   store->set(JSRegExp::kIrregexpTicksUntilTierUpIndex, uninitialized);
   store->set(JSRegExp::kIrregexpBacktrackLimit, uninitialized);
+  store->set(JSRegExp::kIrregexpPrefilterIndex, uninitialized);
+  store->set(JSRegExp::kExperimentalDfaIndex, uninitialized);
   regexp->set_data(store);
 }
 
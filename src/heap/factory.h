@@ -990,10 +990,12 @@ class V8_EXPORT_PRIVATE Factory : public FactoryBase<Factory> {
                          DirectHandle<Object> match_pattern);
 
   // Creates a new FixedArray that holds the data associated with the
-  // irregexp regexp and stores it in the regexp.
+  // irregexp regexp and stores it in the regexp. `prefilter` is a literal
+  // that every match starts with, if known.
   void SetRegExpIrregexpData(DirectHandle<JSRegExp> regexp,
                              DirectHandle<String> source, JSRegExp::Flags flags,
-                             int capture_count, uint32_t backtrack_limit);
+                             int capture_count, uint32_t backtrack_limit,
+                             MaybeDirectHandle<String> prefilter);
 
   // Creates a new FixedArray that holds the data associated with the
   // experimental regexp and stores it in the regexp.
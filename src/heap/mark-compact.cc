@@ -2569,11 +2569,13 @@ class ClearStringTableJobItem final : public ParallelClearingJob::ClearingItem {
       // string table.  Cannot use string_table() here because the string
       // table is marked.
       StringTable* string_table = isolate_->string_table();
-      InternalizedStringTableCleaner internalized_visitor(isolate_->heap());
       string_table->DropOldData();
-      string_table->IterateElements(&internalized_visitor);
-      string_table->NotifyElementsRemoved(
-          internalized_visitor.PointersRemoved());
+      for (int shard = 0; shard < StringTable::kShardCount; shard++) {
+        InternalizedStringTableCleaner internalized_visitor(isolate_->heap());
+        string_table->IterateElements(shard, &internalized_visitor);
+        string_table->NotifyElementsRemoved(
+            shard, internalized_visitor.PointersRemoved());
+      }
     }
   }
 
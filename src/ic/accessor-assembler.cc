@@ -3029,7 +3029,7 @@ TNode<IntPtrT> AccessorAssembler::StubCachePrimaryOffset(TNode<Name> name,
       WordXor(map_word, WordShr(map_word, StubCache::kPrimaryTableBits))));
   // Base the offset on a simple combination of name and map.
   TNode<Word32T> hash = Int32Add(raw_hash_field, map32);
-  uint32_t mask = (StubCache::kPrimaryTableSize - 1)
+  uint32_t mask = (StubCache::kMaxPrimaryTableSize - 1)
                   << StubCache::kCacheIndexShift;
   TNode<UintPtrT> result =
       ChangeUint32ToWord(Word32And(hash, Int32Constant(mask)));
@@ -3047,7 +3047,7 @@ TNode<IntPtrT> AccessorAssembler::StubCacheSecondaryOffset(TNode<Name> name,
   TNode<Word32T> hash_a = Int32Add(map32, name32);
   TNode<Word32T> hash_b = Word32Shr(hash_a, StubCache::kSecondaryTableBits);
   TNode<Word32T> hash = Int32Add(hash_a, hash_b);
-  int32_t mask = (StubCache::kSecondaryTableSize - 1)
+  int32_t mask = (StubCache::kMaxSecondaryTableSize - 1)
                  << StubCache::kCacheIndexShift;
   TNode<UintPtrT> result =
       ChangeUint32ToWord(Word32And(hash, Int32Constant(mask)));
@@ -3059,14 +3059,19 @@ void AccessorAssembler::TryProbeStubCacheTable(
     TNode<Object> name, TNode<Map> map, Label* if_handler,
     TVariable<MaybeObject>* var_handler, Label* if_miss) {
   StubCache::Table table = static_cast<StubCache::Table>(table_id);
+  // The tables grow at runtime, so the offset was computed for the largest
+  // table and has to be masked to the current size.
+  TNode<Uint32T> mask = Load<Uint32T>(ExternalConstant(
+      ExternalReference::Create(stub_cache->mask_reference(table))));
+  entry_offset = WordAnd(entry_offset, Signed(ChangeUint32ToWord(mask)));
   // The {table_offset} holds the entry offset times four (due to masking
   // and shifting optimizations).
   const int kMultiplier =
       sizeof(StubCache::Entry) >> StubCache::kCacheIndexShift;
   entry_offset = IntPtrMul(entry_offset, IntPtrConstant(kMultiplier));
 
-  TNode<ExternalReference> key_base = ExternalConstant(
-      ExternalReference::Create(stub_cache->key_reference(table)));
+  TNode<RawPtrT> key_base = Load<RawPtrT>(ExternalConstant(
+      ExternalReference::Create(stub_cache->table_reference(table))));
 
   // Check that the key in the entry matches the name.
   DCHECK_EQ(0, offsetof(StubCache::Entry, key));
@@ -4,6 +4,8 @@
 
 #include "src/ic/ic.h"
 
+#include <algorithm>
+
 #include "src/api/api-arguments-inl.h"
 #include "src/ast/ast.h"
 #include "src/base/logging.h"
@@ -571,6 +573,13 @@ Handle<NativeContext> GetAccessorContext(
   return handle(maybe_context.value(), isolate);
 }
 
+// Accesses by name track at least as many maps as element accesses, so
+// raising --max-valid-polymorphic-map-count raises both limits.
+int MaxValidPolymorphicNamedMapCount() {
+  return std::max<int>(v8_flags.max_valid_polymorphic_named_map_count,
+                       v8_flags.max_valid_polymorphic_map_count);
+}
+
 }  // namespace
 
 bool IC::UpdateMegaDOMIC(const MaybeObjectHandle& handler, Handle<Name> name) {
@@ -638,7 +647,8 @@ bool IC::UpdatePolymorphicIC(Handle<Name> name,
   Handle<Map> map = lookup_start_object_map();
 
   std::vector<MapAndHandler> maps_and_handlers;
-  maps_and_handlers.reserve(v8_flags.max_valid_polymorphic_map_count);
+  const int max_valid_maps = MaxValidPolymorphicNamedMapCount();
+  maps_and_handlers.reserve(max_valid_maps);
   int deprecated_maps = 0;
   int handler_to_overwrite = -1;
 
@@ -685,12 +695,12 @@ bool IC::UpdatePolymorphicIC(Handle<Name> name,
   int number_of_valid_maps =
       number_of_maps - deprecated_maps - (handler_to_overwrite != -1);
 
-  if (number_of_valid_maps >= v8_flags.max_valid_polymorphic_map_count) {
-    return false;
-  }
-  if (deprecated_maps >= v8_flags.max_valid_polymorphic_map_count) {
-    return false;
-  }
+  // Accesses by name allow more maps than element accesses, since their
+  // handlers are cheap to compute and the optimizing compilers merge the maps
+  // that share an access path into a single map check. Beyond the limit, the
+  // megamorphic stub cache is cheaper than a linear search.
+  if (number_of_valid_maps >= max_valid_maps) return false;
+  if (deprecated_maps >= max_valid_maps) return false;
   if (number_of_maps == 0 && state() != MONOMORPHIC && state() != POLYMORPHIC) {
     return false;
   }
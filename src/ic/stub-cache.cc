@@ -6,6 +6,7 @@
 
 #include "src/ast/ast.h"
 #include "src/base/bits.h"
+#include "src/flags/flags.h"
 #include "src/heap/heap-inl.h"  // For InYoungGeneration().
 #include "src/ic/ic-inl.h"
 #include "src/logging/counters.h"
@@ -18,6 +19,7 @@ StubCache::StubCache(Isolate* isolate) : isolate_(isolate) {
   // Ensure the nullptr (aka Smi::zero()) which StubCache::Get() returns
   // when the entry is not found is not considered as a handler.
   DCHECK(!IC::IsHandler(Tagged<MaybeObject>()));
+  AllocateTables(kPrimaryTableBits);
 }
 
 void StubCache::Initialize() {
@@ -26,9 +28,47 @@ void StubCache::Initialize() {
   Clear();
 }
 
+void StubCache::AllocateTables(int primary_table_bits) {
+  DCHECK_LE(primary_table_bits, kMaxPrimaryTableBits);
+  int secondary_table_bits =
+      primary_table_bits - (kPrimaryTableBits - kSecondaryTableBits);
+  int primary_table_size = 1 << primary_table_bits;
+  int secondary_table_size = 1 << secondary_table_bits;
+  primary_storage_ = std::make_unique<Entry[]>(primary_table_size);
+  secondary_storage_ = std::make_unique<Entry[]>(secondary_table_size);
+  primary_ = primary_storage_.get();
+  secondary_ = secondary_storage_.get();
+  primary_mask_ = (primary_table_size - 1) << kCacheIndexShift;
+  secondary_mask_ = (secondary_table_size - 1) << kCacheIndexShift;
+}
+
+void StubCache::MaybeGrow(bool evicted) {
+  updates_++;
+  if (evicted) evictions_++;
+  // Review the size once there have been as many updates as there are primary
+  // entries. Most updates evicting a live entry means that the working set of
+  // the megamorphic accesses doesn't fit into the tables.
+  int primary_table_size = table_size(kPrimary);
+  if (updates_ < primary_table_size) return;
+  bool grow = evictions_ > updates_ / 2 && v8_flags.adaptive_stub_cache &&
+              primary_table_size < kMaxPrimaryTableSize;
+  if (v8_flags.trace_stub_cache) {
+    PrintF("[stub cache %p: %d entries, %d updates, %d evictions%s]\n", this,
+           primary_table_size, updates_, evictions_, grow ? ", growing" : "");
+  }
+  updates_ = 0;
+  evictions_ = 0;
+  if (!grow) return;
+  // The entries are not moved to the larger tables, since they can be
+  // recomputed on the next miss, just like after a GC.
+  AllocateTables(base::bits::WhichPowerOfTwo(primary_table_size) + 1);
+  Clear();
+  isolate()->counters()->megamorphic_stub_cache_resizes()->Increment();
+}
+
 // Hash algorithm for the primary table. This algorithm is replicated in
-// the AccessorAssembler.  Returns an index into the table that
-// is scaled by 1 << kCacheIndexShift.
+// the AccessorAssembler.  Returns an index into a table of the largest size
+// that is scaled by 1 << kCacheIndexShift.
 int StubCache::PrimaryOffset(Tagged<Name> name, Tagged<Map> map) {
   // Compute the hash of the name (use entire hash field).
   uint32_t field = name->RawHash();
@@ -40,19 +80,20 @@ int StubCache::PrimaryOffset(Tagged<Name> name, Tagged<Map> map) {
       static_cast<uint32_t>(map.ptr() ^ (map.ptr() >> kPrimaryTableBits));
   // Base the offset on a simple combination of name and map.
   uint32_t key = map_low32bits + field;
-  return key & ((kPrimaryTableSize - 1) << kCacheIndexShift);
+  return key & ((kMaxPrimaryTableSize - 1) << kCacheIndexShift);
 }
 
 // Hash algorithm for the secondary table.  This algorithm is replicated in
 // assembler. This hash should be sufficiently different from the primary one
 // in order to avoid collisions for minified code with short names.
-// Returns an index into the table that is scaled by 1 << kCacheIndexShift.
+// Returns an index into a table of the largest size that is scaled by
+// 1 << kCacheIndexShift.
 int StubCache::SecondaryOffset(Tagged<Name> name, Tagged<Map> old_map) {
   uint32_t name_low32bits = static_cast<uint32_t>(name.ptr());
   uint32_t map_low32bits = static_cast<uint32_t>(old_map.ptr());
   uint32_t key = (map_low32bits + name_low32bits);
   key = key + (key >> kSecondaryTableBits);
-  return key & ((kSecondaryTableSize - 1) << kCacheIndexShift);
+  return key & ((kMaxSecondaryTableSize - 1) << kCacheIndexShift);
 }
 
 int StubCache::PrimaryOffsetForTesting(Tagged<Name> name, Tagged<Map> map) {
@@ -85,23 +126,17 @@ void StubCache::Set(Tagged<Name> name, Tagged<Map> map,
   DCHECK(CommonStubCacheChecks(this, name, map, handler));
 
   // Compute the primary entry.
-  int primary_offset = PrimaryOffset(name, map);
-  Entry* primary = entry(primary_, primary_offset);
-  Tagged<MaybeObject> old_handler(
-      TaggedValue::ToMaybeObject(isolate(), primary->value));
+  Entry* primary = primary_entry(name, map);
   // If the primary entry has useful data in it, we retire it to the
   // secondary cache before overwriting it.
-  // We need SafeEquals here while Builtin Code objects still live in the RO
-  // space inside the sandbox.
-  static_assert(!kAllCodeObjectsLiveInTrustedSpace);
-  if (!old_handler.SafeEquals(isolate()->builtins()->code(Builtin::kIllegal)) &&
-      !primary->map.IsSmi()) {
+  bool evicted = false;
+  if (IsLive(primary)) {
     Tagged<Map> old_map =
         Map::cast(StrongTaggedValue::ToObject(isolate(), primary->map));
     Tagged<Name> old_name =
         Name::cast(StrongTaggedValue::ToObject(isolate(), primary->key));
-    int secondary_offset = SecondaryOffset(old_name, old_map);
-    Entry* secondary = entry(secondary_, secondary_offset);
+    Entry* secondary = secondary_entry(old_name, old_map);
+    evicted = IsLive(secondary);
     *secondary = *primary;
   }
 
@@ -110,17 +145,26 @@ void StubCache::Set(Tagged<Name> name, Tagged<Map> map,
   primary->value = TaggedValue(handler);
   primary->map = StrongTaggedValue(map);
   isolate()->counters()->megamorphic_stub_cache_updates()->Increment();
+  MaybeGrow(evicted);
+}
+
+bool StubCache::IsLive(Entry* entry) {
+  Tagged<MaybeObject> handler(
+      TaggedValue::ToMaybeObject(isolate(), entry->value));
+  // We need SafeEquals here while Builtin Code objects still live in the RO
+  // space inside the sandbox.
+  static_assert(!kAllCodeObjectsLiveInTrustedSpace);
+  return !handler.SafeEquals(isolate()->builtins()->code(Builtin::kIllegal)) &&
+         !entry->map.IsSmi();
 }
 
 Tagged<MaybeObject> StubCache::Get(Tagged<Name> name, Tagged<Map> map) {
   DCHECK(CommonStubCacheChecks(this, name, map, Tagged<MaybeObject>()));
-  int primary_offset = PrimaryOffset(name, map);
-  Entry* primary = entry(primary_, primary_offset);
+  Entry* primary = primary_entry(name, map);
   if (primary->key == name && primary->map == map) {
     return TaggedValue::ToMaybeObject(isolate(), primary->value);
   }
-  int secondary_offset = SecondaryOffset(name, map);
-  Entry* secondary = entry(secondary_, secondary_offset);
+  Entry* secondary = secondary_entry(name, map);
   if (secondary->key == name && secondary->map == map) {
     return TaggedValue::ToMaybeObject(isolate(), secondary->value);
   }
@@ -130,12 +174,12 @@ Tagged<MaybeObject> StubCache::Get(Tagged<Name> name, Tagged<Map> map) {
 void StubCache::Clear() {
   Tagged<MaybeObject> empty = isolate_->builtins()->code(Builtin::kIllegal);
   Tagged<Name> empty_string = ReadOnlyRoots(isolate()).empty_string();
-  for (int i = 0; i < kPrimaryTableSize; i++) {
+  for (int i = 0; i < table_size(kPrimary); i++) {
     primary_[i].key = StrongTaggedValue(empty_string);
     primary_[i].map = StrongTaggedValue(Smi::zero());
     primary_[i].value = TaggedValue(empty);
   }
-  for (int j = 0; j < kSecondaryTableSize; j++) {
+  for (int j = 0; j < table_size(kSecondary); j++) {
     secondary_[j].key = StrongTaggedValue(empty_string);
     secondary_[j].map = StrongTaggedValue(Smi::zero());
     secondary_[j].value = TaggedValue(empty);
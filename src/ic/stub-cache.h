@@ -5,6 +5,8 @@
 #ifndef V8_IC_STUB_CACHE_H_
 #define V8_IC_STUB_CACHE_H_
 
+#include <memory>
+
 #include "include/v8-callbacks.h"
 #include "src/objects/name.h"
 #include "src/objects/tagged-value.h"
@@ -16,6 +18,12 @@ namespace internal {
 // It maps (map, name, type) to property access handlers. The cache does not
 // need explicit invalidation when a prototype chain is modified, since the
 // handlers verify the chain.
+//
+// The tables start out small and grow (up to kMaxPrimaryTableBits) when most
+// updates evict a live entry from the secondary table, which happens when the
+// megamorphic accesses of a program see many more (map, name) pairs than fit.
+// Generated code therefore loads the current tables and their masks from the
+// StubCache instead of embedding them.
 
 class SCTableReference {
  public:
@@ -51,19 +59,27 @@ class V8_EXPORT_PRIVATE StubCache {
 
   enum Table { kPrimary, kSecondary };
 
-  SCTableReference key_reference(StubCache::Table table) {
-    return SCTableReference(
-        reinterpret_cast<Address>(&first_entry(table)->key));
-  }
-
-  SCTableReference map_reference(StubCache::Table table) {
-    return SCTableReference(
-        reinterpret_cast<Address>(&first_entry(table)->map));
+  // The address of the pointer to the first entry of {table}.
+  SCTableReference table_reference(StubCache::Table table) {
+    switch (table) {
+      case StubCache::kPrimary:
+        return SCTableReference(reinterpret_cast<Address>(&primary_));
+      case StubCache::kSecondary:
+        return SCTableReference(reinterpret_cast<Address>(&secondary_));
+    }
+    UNREACHABLE();
   }
 
-  SCTableReference value_reference(StubCache::Table table) {
-    return SCTableReference(
-        reinterpret_cast<Address>(&first_entry(table)->value));
+  // The address of the uint32_t mask that maps the offsets computed by
+  // PrimaryOffset and SecondaryOffset to the current size of {table}.
+  SCTableReference mask_reference(StubCache::Table table) {
+    switch (table) {
+      case StubCache::kPrimary:
+        return SCTableReference(reinterpret_cast<Address>(&primary_mask_));
+      case StubCache::kSecondary:
+        return SCTableReference(reinterpret_cast<Address>(&secondary_mask_));
+    }
+    UNREACHABLE();
   }
 
   StubCache::Entry* first_entry(StubCache::Table table) {
@@ -76,6 +92,12 @@ class V8_EXPORT_PRIVATE StubCache {
     UNREACHABLE();
   }
 
+  int table_size(StubCache::Table table) const {
+    uint32_t mask =
+        table == StubCache::kPrimary ? primary_mask_ : secondary_mask_;
+    return static_cast<int>(mask >> kCacheIndexShift) + 1;
+  }
+
   Isolate* isolate() { return isolate_; }
 
   // Setting kCacheIndexShift to Name::HashBits::kShift is convenient because it
@@ -85,10 +107,17 @@ class V8_EXPORT_PRIVATE StubCache {
   // the static_assert below, in {entry(...)}).
   static const int kCacheIndexShift = Name::HashBits::kShift;
 
+  // The initial table sizes.
   static const int kPrimaryTableBits = 11;
   static const int kPrimaryTableSize = (1 << kPrimaryTableBits);
   static const int kSecondaryTableBits = 9;
   static const int kSecondaryTableSize = (1 << kSecondaryTableBits);
+  // The largest table sizes, which the offsets are computed for.
+  static const int kMaxPrimaryTableBits = 14;
+  static const int kMaxPrimaryTableSize = (1 << kMaxPrimaryTableBits);
+  static const int kMaxSecondaryTableBits =
+      kMaxPrimaryTableBits - (kPrimaryTableBits - kSecondaryTableBits);
+  static const int kMaxSecondaryTableSize = (1 << kMaxSecondaryTableBits);
 
   static int PrimaryOffsetForTesting(Tagged<Name> name, Tagged<Map> map);
   static int SecondaryOffsetForTesting(Tagged<Name> name, Tagged<Map> map);
@@ -107,13 +136,15 @@ class V8_EXPORT_PRIVATE StubCache {
   // entries are overwritten.
 
   // Hash algorithm for the primary table.  This algorithm is replicated in
-  // assembler for every architecture.  Returns an index into the table that
-  // is scaled by 1 << kCacheIndexShift.
+  // assembler for every architecture.  Returns an index into a table of
+  // kMaxPrimaryTableSize entries that is scaled by 1 << kCacheIndexShift, which
+  // has to be masked with {primary_mask_}.
   static int PrimaryOffset(Tagged<Name> name, Tagged<Map> map);
 
   // Hash algorithm for the secondary table.  This algorithm is replicated in
-  // assembler for every architecture.  Returns an index into the table that
-  // is scaled by 1 << kCacheIndexShift.
+  // assembler for every architecture.  Returns an index into a table of
+  // kMaxSecondaryTableSize entries that is scaled by 1 << kCacheIndexShift,
+  // which has to be masked with {secondary_mask_}.
   static int SecondaryOffset(Tagged<Name> name, Tagged<Map> map);
 
   // Compute the entry for a given offset in exactly the same way as
@@ -130,9 +161,35 @@ class V8_EXPORT_PRIVATE StubCache {
                                     offset * multiplier);
   }
 
+  Entry* primary_entry(Tagged<Name> name, Tagged<Map> map) {
+    return entry(primary_,
+                 static_cast<int>(PrimaryOffset(name, map) & primary_mask_));
+  }
+  Entry* secondary_entry(Tagged<Name> name, Tagged<Map> map) {
+    return entry(secondary_, static_cast<int>(SecondaryOffset(name, map) &
+                                              secondary_mask_));
+  }
+
+  // Allocates the tables for 1 << {primary_table_bits} primary entries. They
+  // have to be cleared before they are used.
+  void AllocateTables(int primary_table_bits);
+  // Returns true if {entry} holds a handler rather than being cleared.
+  bool IsLive(Entry* entry);
+  // Called after every update, grows the tables if too many of the updates
+  // evicted a live entry.
+  void MaybeGrow(bool evicted);
+
  private:
-  Entry primary_[kPrimaryTableSize];
-  Entry secondary_[kSecondaryTableSize];
+  Entry* primary_;
+  Entry* secondary_;
+  uint32_t primary_mask_;
+  uint32_t secondary_mask_;
+  std::unique_ptr<Entry[]> primary_storage_;
+  std::unique_ptr<Entry[]> secondary_storage_;
+  // The number of updates, and of live entries that were evicted from the
+  // secondary table by them, since the size of the tables was last reviewed.
+  int updates_ = 0;
+  int evictions_ = 0;
   Isolate* isolate_;
 
   friend class Isolate;
@@ -4,6 +4,7 @@
 
 #include "src/json/json-parser.h"
 
+#include "src/base/functional.h"
 #include "src/base/strings.h"
 #include "src/builtins/builtins.h"
 #include "src/common/assert-scope.h"
@@ -12,6 +13,7 @@
 #include "src/debug/debug.h"
 #include "src/execution/frames-inl.h"
 #include "src/heap/factory.h"
+#include "src/json/json-simd.h"
 #include "src/numbers/conversions.h"
 #include "src/numbers/hash-seed-inl.h"
 #include "src/objects/elements-kind.h"
@@ -24,6 +26,7 @@
 #include "src/roots/roots.h"
 #include "src/strings/char-predicates-inl.h"
 #include "src/strings/string-hasher.h"
+#include "src/strings/unicode-decoder.h"
 #include "src/utils/boxed-float.h"
 
 namespace v8 {
@@ -126,6 +129,73 @@ static const constexpr uint8_t character_json_scan_flags[256] = {
 #undef CALL_GET_SCAN_FLAGS
 };
 
+// Vectorized scanning helpers. Each helper inspects a full vector of
+// characters at a time and returns a pointer to the first character that the
+// corresponding scalar loop would stop at, or to the start of the remaining
+// tail once fewer than a full vector of characters is left. Callers then run
+// their scalar loop from the returned position, which finishes the tail and
+// handles the stop character itself.
+#ifdef V8_JSON_SIMD
+
+template <typename Char>
+const Char* SkipJsonWhitespaceVectorized(const Char* cursor, const Char* end) {
+  return JsonSimdFind(cursor, end, JsonSimdIsNotWhitespace<Char>);
+}
+
+template <typename Char>
+const Char* SkipDecimalDigitsVectorized(const Char* cursor, const Char* end) {
+  return JsonSimdFind(cursor, end, JsonSimdIsNotDecimalDigit<Char>);
+}
+
+// In addition to skipping string contents, records in |bits| whether any of
+// the skipped two-byte characters is outside of Latin1, matching what the
+// scalar loop in ScanJsonString accumulates.
+template <typename Char>
+const Char* SkipJsonStringCharactersVectorized(const Char* cursor,
+                                               const Char* end,
+                                               base::uc32* bits) {
+  constexpr size_t kLanes = kJsonSimdBytes / sizeof(Char);
+  bool has_non_latin1 = false;
+  while (static_cast<size_t>(end - cursor) >= kLanes) {
+    JsonSimdVector v = JsonSimdLoad<Char>(cursor);
+    size_t index =
+        JsonSimdFirstSetLane<Char>(JsonSimdMayTerminateString<Char>(v));
+    if (index < kLanes) {
+      // For two-byte input, leave the partially consumed vector to the scalar
+      // loop, which also takes care of the Latin1 check for it.
+      if constexpr (sizeof(Char) == 1) cursor += index;
+      break;
+    }
+    if constexpr (sizeof(Char) == 2) {
+      has_non_latin1 = has_non_latin1 || JsonSimdHasNonLatin1(v);
+    }
+    cursor += kLanes;
+  }
+  if (has_non_latin1) *bits |= unibrow::Latin1::kMaxChar + 1;
+  return cursor;
+}
+
+#else  // !V8_JSON_SIMD
+
+template <typename Char>
+const Char* SkipJsonWhitespaceVectorized(const Char* cursor, const Char* end) {
+  return cursor;
+}
+
+template <typename Char>
+const Char* SkipDecimalDigitsVectorized(const Char* cursor, const Char* end) {
+  return cursor;
+}
+
+template <typename Char>
+const Char* SkipJsonStringCharactersVectorized(const Char* cursor,
+                                               const Char* end,
+                                               base::uc32* bits) {
+  return cursor;
+}
+
+#endif  // V8_JSON_SIMD
+
 }  // namespace
 
 MaybeHandle<Object> JsonParseInternalizer::Internalize(
@@ -568,6 +638,7 @@ template <typename Char>
 void JsonParser<Char>::SkipWhitespace() {
   JsonToken local_next = JsonToken::EOS;
 
+  cursor_ = SkipJsonWhitespaceVectorized(cursor_, end_);
   cursor_ = std::find_if(cursor_, end_, [&](Char c) {
     JsonToken current = GetTokenForCharacter(c);
     bool result = current != JsonToken::WHITESPACE;
@@ -1272,18 +1343,69 @@ class JsonParser<Char>::NamedPropertyIterator {
   const JsonProperty* end_;
 };
 
+bool JsonObjectShapeCache::Lookup(Isolate* isolate, uint32_t fingerprint,
+                                  Tagged<Map>* map) {
+  const Entry& entry = entries_[GetIndex(fingerprint)];
+  if (entry.map == kNullAddress || entry.fingerprint != fingerprint) {
+    isolate->counters()->json_parse_shape_cache_misses()->Increment();
+    return false;
+  }
+  isolate->counters()->json_parse_shape_cache_hits()->Increment();
+  *map = Map::cast(Tagged<Object>(entry.map));
+  return true;
+}
+
+void JsonObjectShapeCache::Insert(uint32_t fingerprint, Tagged<Map> map) {
+  entries_[GetIndex(fingerprint)] = {fingerprint, map.ptr()};
+}
+
+void JsonObjectShapeCache::Clear() {
+  for (Entry& entry : entries_) entry = {};
+}
+
+template <typename Char>
+uint32_t JsonParser<Char>::ComputeShapeFingerprint(size_t start) {
+  DisallowGarbageCollection no_gc;
+  // Only the length and first character of each key are used, so that
+  // computing the fingerprint stays cheap compared to building the object.
+  uint32_t hash = 0;
+  for (size_t i = start; i < property_stack_.size(); i++) {
+    const JsonString& key = property_stack_[i].string;
+    if (key.is_index()) continue;
+    uint32_t first = key.length() > 0 ? chars_[key.start()] : 0;
+    hash = static_cast<uint32_t>(base::hash_combine(hash, key.length(), first));
+  }
+  return hash;
+}
+
 template <typename Char>
 Handle<JSObject> JsonParser<Char>::BuildJsonObject(const JsonContinuation& cont,
                                                    Handle<Map> feedback) {
-  if (!feedback.is_null() && feedback->is_deprecated()) {
-    feedback = Map::Update(isolate_, feedback);
-  }
   size_t start = cont.index;
   DCHECK_LE(start, property_stack_.size());
   int length = static_cast<int>(property_stack_.size() - start);
   int named_length = length - cont.elements;
   DCHECK_LE(0, named_length);
 
+  // Without feedback from a sibling, look for an object of the same shape that
+  // was parsed recently.
+  JsonObjectShapeCache* shape_cache = nullptr;
+  uint32_t shape_fingerprint = 0;
+  if (feedback.is_null() && named_length > 0) {
+    shape_cache = isolate_->json_object_shape_cache();
+    shape_fingerprint = ComputeShapeFingerprint(start);
+    Tagged<Map> cached_map;
+    // Only use maps of plain objects from the current native context.
+    if (shape_cache->Lookup(isolate_, shape_fingerprint, &cached_map) &&
+        cached_map->GetConstructor() == *object_constructor_ &&
+        !cached_map->IsDetached(isolate_)) {
+      feedback = handle(cached_map, isolate_);
+    }
+  }
+  if (!feedback.is_null() && feedback->is_deprecated()) {
+    feedback = Map::Update(isolate_, feedback);
+  }
+
   Handle<FixedArrayBase> elements;
   ElementsKind elements_kind = HOLEY_ELEMENTS;
 
@@ -1331,7 +1453,12 @@ Handle<JSObject> JsonParser<Char>::BuildJsonObject(const JsonContinuation& cont,
   NamedPropertyIterator it(*this, property_stack_.begin() + start,
                            property_stack_.end());
 
-  return js_data_object_builder.BuildFromIterator(it, elements);
+  Handle<JSObject> object =
+      js_data_object_builder.BuildFromIterator(it, elements);
+  if (shape_cache != nullptr && !object->map()->is_dictionary_map()) {
+    shape_cache->Insert(shape_fingerprint, object->map());
+  }
+  return object;
 }
 
 template <typename Char>
@@ -1865,6 +1992,7 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonValue() {
 
 template <typename Char>
 void JsonParser<Char>::AdvanceToNonDecimal() {
+  cursor_ = SkipDecimalDigitsVectorized(cursor_, end_);
   cursor_ =
       std::find_if(cursor_, end_, [](Char c) { return !IsDecimalDigit(c); });
 }
@@ -2105,6 +2233,7 @@ JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
   base::uc32 bits = 0;
 
   while (true) {
+    cursor_ = SkipJsonStringCharactersVectorized(cursor_, end_, &bits);
     cursor_ = std::find_if(cursor_, end_, [&bits](Char c) {
       if (sizeof(Char) == 2 && V8_UNLIKELY(c > unibrow::Latin1::kMaxChar)) {
         bits |= c;
@@ -2194,5 +2323,77 @@ JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
 template class JsonParser<uint8_t>;
 template class JsonParser<uint16_t>;
 
+namespace {
+
+// Owns the collected text of a JsonChunkedSource once it has been handed to
+// the heap as the backing store of an external string.
+class JsonChunkedSourceResource final
+    : public v8::String::ExternalOneByteStringResource {
+ public:
+  explicit JsonChunkedSourceResource(std::vector<char> chars)
+      : chars_(std::move(chars)) {}
+
+  const char* data() const override { return chars_.data(); }
+  size_t length() const override { return chars_.size(); }
+
+ private:
+  std::vector<char> chars_;
+};
+
+// Shorter sources are copied onto the heap, since the bookkeeping for an
+// external string would cost more than the copy.
+constexpr size_t kMinExternalJsonSourceLength = 4 * KB;
+
+}  // namespace
+
+void JsonChunkedSource::AddChunk(const char* data, size_t length) {
+  if (is_ascii_) {
+    const uint8_t* chars = reinterpret_cast<const uint8_t*>(data);
+    size_t checked = 0;
+    while (checked < length) {
+      int step = static_cast<int>(std::min<size_t>(length - checked, kMaxInt));
+      if (NonAsciiStart(chars + checked, step) < step) {
+        is_ascii_ = false;
+        break;
+      }
+      checked += step;
+    }
+  }
+  buffer_.insert(buffer_.end(), data, data + length);
+}
+
+MaybeHandle<String> JsonChunkedSource::MakeSource(Isolate* isolate) {
+  Factory* factory = isolate->factory();
+  if (is_ascii_ && buffer_.size() >= kMinExternalJsonSourceLength &&
+      buffer_.size() <= static_cast<size_t>(String::kMaxLength)) {
+    auto resource =
+        std::make_unique<JsonChunkedSourceResource>(std::move(buffer_));
+    Handle<String> source;
+    if (factory->NewExternalStringFromOneByte(resource.get())
+            .ToHandle(&source)) {
+      // The string owns the resource now.
+      resource.release();
+      return source;
+    }
+    return MaybeHandle<String>();
+  }
+  std::vector<char> buffer = std::move(buffer_);
+  if (is_ascii_) {
+    return factory->NewStringFromOneByte(base::Vector<const uint8_t>(
+        reinterpret_cast<const uint8_t*>(buffer.data()), buffer.size()));
+  }
+  return factory->NewStringFromUtf8(
+      base::Vector<const char>(buffer.data(), buffer.size()));
+}
+
+MaybeHandle<Object> JsonChunkedSource::Parse(Isolate* isolate) {
+  Handle<String> source;
+  ASSIGN_RETURN_ON_EXCEPTION(isolate, source, MakeSource(isolate), Object);
+  Handle<Object> undefined = isolate->factory()->undefined_value();
+  return String::IsOneByteRepresentationUnderneath(*source)
+             ? JsonParser<uint8_t>::Parse(isolate, source, undefined)
+             : JsonParser<uint16_t>::Parse(isolate, source, undefined);
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -5,6 +5,8 @@
 #ifndef V8_JSON_JSON_PARSER_H_
 #define V8_JSON_JSON_PARSER_H_
 
+#include <vector>
+
 #include "include/v8-callbacks.h"
 #include "src/base/small-vector.h"
 #include "src/base/strings.h"
@@ -148,6 +150,39 @@ enum class JsonToken : uint8_t {
   EOS
 };
 
+// Remembers the final maps of recently parsed JSON objects, keyed by a cheap
+// fingerprint of their property keys. The parser uses a hit as the expected
+// final map of an object that has no preceding sibling in the same array to
+// take feedback from, e.g. nested objects or the top-level objects of repeated
+// JSON.parse calls. A fingerprint collision only costs leaving the fast path,
+// since every key is still checked against the map's descriptors.
+//
+// The cache is not visited by the GC. Maps are never allocated in the young
+// generation, so only a mark-compact can free or move them, and the heap clears
+// the cache before every mark-compact like the descriptor lookup cache.
+class JsonObjectShapeCache final {
+ public:
+  bool Lookup(Isolate* isolate, uint32_t fingerprint, Tagged<Map>* map);
+  void Insert(uint32_t fingerprint, Tagged<Map> map);
+  void Clear();
+
+ private:
+  struct Entry {
+    uint32_t fingerprint;
+    Address map;
+  };
+
+  static constexpr int kSizeBits = 6;
+  static constexpr int kSize = 1 << kSizeBits;
+  static constexpr int kIndexMask = kSize - 1;
+
+  static int GetIndex(uint32_t fingerprint) {
+    return (fingerprint ^ (fingerprint >> kSizeBits)) & kIndexMask;
+  }
+
+  Entry entries_[kSize] = {};
+};
+
 // A simple json parser.
 template <typename Char>
 class JsonParser final {
@@ -332,6 +367,9 @@ class JsonParser final {
 
   Handle<JSObject> BuildJsonObject(const JsonContinuation& cont,
                                    Handle<Map> feedback);
+  // Computes the JsonObjectShapeCache fingerprint of the named properties of
+  // the object starting at |start| in the property stack.
+  uint32_t ComputeShapeFingerprint(size_t start);
   Handle<Object> BuildJsonArray(size_t start);
 
   static const int kMaxContextCharacters = 10;
@@ -417,6 +455,25 @@ class JsonParser final {
 extern template class JsonParser<uint8_t>;
 extern template class JsonParser<uint16_t>;
 
+// Buffers UTF-8 encoded JSON text that is handed over in chunks, and parses it
+// in one go once complete. This backs v8::JSON::ChunkedParser.
+class JsonChunkedSource final {
+ public:
+  void AddChunk(const char* data, size_t length);
+
+  // Parses the collected text. The collected text is consumed, so this can only
+  // be called once.
+  V8_WARN_UNUSED_RESULT MaybeHandle<Object> Parse(Isolate* isolate);
+
+ private:
+  // Creates the string to parse from the collected text, taking ownership of
+  // the text if it is used as the backing store of an external string.
+  MaybeHandle<String> MakeSource(Isolate* isolate);
+
+  std::vector<char> buffer_;
+  bool is_ascii_ = true;
+};
+
 }  // namespace internal
 }  // namespace v8
 
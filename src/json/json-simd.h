@@ -0,0 +1,245 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_JSON_JSON_SIMD_H_
+#define V8_JSON_JSON_SIMD_H_
+
+#include "src/base/bits.h"
+#include "src/base/macros.h"
+#include "src/strings/unicode.h"
+
+// Vector helpers shared by the JSON parser and stringifier, and by the UTF-8
+// decoder, to classify 16 bytes of one-byte or two-byte characters at a time. SSE2 is part of the x64
+// baseline and Neon is always available on arm64, so no runtime feature
+// detection is needed. V8_JSON_SIMD is left undefined on other hosts, and
+// callers fall back to their scalar loops.
+#if defined(__SSE2__) || \
+    (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86)))
+#define V8_JSON_SIMD 1
+#define V8_JSON_SIMD_SSE2 1
+#include <emmintrin.h>
+#elif defined(V8_HOST_ARCH_ARM64)
+#define V8_JSON_SIMD 1
+#define V8_JSON_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+
+#ifdef V8_JSON_SIMD
+
+namespace v8 {
+namespace internal {
+
+constexpr size_t kJsonSimdBytes = 16;
+
+#ifdef V8_JSON_SIMD_SSE2
+
+using JsonSimdVector = __m128i;
+
+template <typename Char>
+V8_INLINE JsonSimdVector JsonSimdLoad(const Char* p) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+}
+
+template <typename Char>
+V8_INLINE JsonSimdVector JsonSimdSplat(int c) {
+  if constexpr (sizeof(Char) == 1) {
+    return _mm_set1_epi8(static_cast<char>(c));
+  } else {
+    return _mm_set1_epi16(static_cast<int16_t>(c));
+  }
+}
+
+template <typename Char>
+V8_INLINE JsonSimdVector JsonSimdEq(JsonSimdVector a, JsonSimdVector b) {
+  if constexpr (sizeof(Char) == 1) {
+    return _mm_cmpeq_epi8(a, b);
+  } else {
+    return _mm_cmpeq_epi16(a, b);
+  }
+}
+
+// Lanes of |v| that are '"', '\\' or a control character (< 0x20).
+template <typename Char>
+V8_INLINE JsonSimdVector JsonSimdMayTerminateString(JsonSimdVector v) {
+  JsonSimdVector control = JsonSimdEq<Char>(
+      _mm_and_si128(v, JsonSimdSplat<Char>(~0x1F)), _mm_setzero_si128());
+  return _mm_or_si128(
+      _mm_or_si128(JsonSimdEq<Char>(v, JsonSimdSplat<Char>('"')),
+                   JsonSimdEq<Char>(v, JsonSimdSplat<Char>('\\'))),
+      control);
+}
+
+// Lanes of |v| that JSON.stringify has to escape: the characters above, and,
+// for two-byte input, surrogates (paired surrogates are left to the caller).
+template <typename Char>
+V8_INLINE JsonSimdVector JsonSimdNeedsEscaping(JsonSimdVector v) {
+  JsonSimdVector result = JsonSimdMayTerminateString<Char>(v);
+  if constexpr (sizeof(Char) == 2) {
+    JsonSimdVector surrogate = _mm_cmpeq_epi16(
+        _mm_and_si128(v, _mm_set1_epi16(static_cast<int16_t>(0xF800))),
+        _mm_set1_epi16(static_cast<int16_t>(0xD800)));
+    result = _mm_or_si128(result, surrogate);
+  }
+  return result;
+}
+
+// Lanes of |v| that are not JSON whitespace.
+template <typename Char>
+V8_INLINE JsonSimdVector JsonSimdIsNotWhitespace(JsonSimdVector v) {
+  JsonSimdVector space_or_tab =
+      _mm_or_si128(JsonSimdEq<Char>(v, JsonSimdSplat<Char>(' ')),
+                   JsonSimdEq<Char>(v, JsonSimdSplat<Char>('\t')));
+  JsonSimdVector newline =
+      _mm_or_si128(JsonSimdEq<Char>(v, JsonSimdSplat<Char>('\n')),
+                   JsonSimdEq<Char>(v, JsonSimdSplat<Char>('\r')));
+  JsonSimdVector whitespace = _mm_or_si128(space_or_tab, newline);
+  return _mm_andnot_si128(whitespace, _mm_set1_epi8(-1));
+}
+
+// Lanes of |v| that are not decimal digits. The comparisons are signed, which
+// is fine since characters >= 0x80 (resp. 0x8000) compare as negative and are
+// therefore correctly classified as non-digits.
+template <typename Char>
+V8_INLINE JsonSimdVector JsonSimdIsNotDecimalDigit(JsonSimdVector v) {
+  JsonSimdVector below, above;
+  if constexpr (sizeof(Char) == 1) {
+    below = _mm_cmpgt_epi8(JsonSimdSplat<Char>('0'), v);
+    above = _mm_cmpgt_epi8(v, JsonSimdSplat<Char>('9'));
+  } else {
+    below = _mm_cmpgt_epi16(JsonSimdSplat<Char>('0'), v);
+    above = _mm_cmpgt_epi16(v, JsonSimdSplat<Char>('9'));
+  }
+  return _mm_or_si128(below, above);
+}
+
+// Returns the index of the first set lane of |mask|, or the number of lanes
+// if no lane is set.
+template <typename Char>
+V8_INLINE size_t JsonSimdFirstSetLane(JsonSimdVector mask) {
+  uint32_t bits = static_cast<uint32_t>(_mm_movemask_epi8(mask));
+  if (bits == 0) return kJsonSimdBytes / sizeof(Char);
+  return base::bits::CountTrailingZeros32(bits) / sizeof(Char);
+}
+
+// Lanes of the one-byte vector |v| that are not ASCII, i.e. have the top bit
+// set.
+V8_INLINE JsonSimdVector JsonSimdIsNonAscii(JsonSimdVector v) {
+  return _mm_cmplt_epi8(v, _mm_setzero_si128());
+}
+
+// Whether any lane of the two-byte vector |v| is outside of Latin1.
+V8_INLINE bool JsonSimdHasNonLatin1(JsonSimdVector v) {
+  JsonSimdVector latin1 = _mm_cmpeq_epi16(
+      _mm_and_si128(v, _mm_set1_epi16(static_cast<int16_t>(0xFF00))),
+      _mm_setzero_si128());
+  return _mm_movemask_epi8(latin1) != 0xFFFF;
+}
+
+#else  // V8_JSON_SIMD_NEON
+
+using JsonSimdVector = uint8x16_t;
+
+template <typename Char>
+V8_INLINE JsonSimdVector JsonSimdLoad(const Char* p) {
+  return vld1q_u8(reinterpret_cast<const uint8_t*>(p));
+}
+
+template <typename Char>
+V8_INLINE JsonSimdVector JsonSimdMayTerminateString(JsonSimdVector v) {
+  if constexpr (sizeof(Char) == 1) {
+    return vorrq_u8(vorrq_u8(vceqq_u8(v, vdupq_n_u8('"')),
+                             vceqq_u8(v, vdupq_n_u8('\\'))),
+                    vcltq_u8(v, vdupq_n_u8(0x20)));
+  } else {
+    uint16x8_t w = vreinterpretq_u16_u8(v);
+    return vreinterpretq_u8_u16(
+        vorrq_u16(vorrq_u16(vceqq_u16(w, vdupq_n_u16('"')),
+                            vceqq_u16(w, vdupq_n_u16('\\'))),
+                  vcltq_u16(w, vdupq_n_u16(0x20))));
+  }
+}
+
+template <typename Char>
+V8_INLINE JsonSimdVector JsonSimdNeedsEscaping(JsonSimdVector v) {
+  JsonSimdVector result = JsonSimdMayTerminateString<Char>(v);
+  if constexpr (sizeof(Char) == 2) {
+    uint16x8_t surrogate =
+        vceqq_u16(vandq_u16(vreinterpretq_u16_u8(v), vdupq_n_u16(0xF800)),
+                  vdupq_n_u16(0xD800));
+    result = vorrq_u8(result, vreinterpretq_u8_u16(surrogate));
+  }
+  return result;
+}
+
+template <typename Char>
+V8_INLINE JsonSimdVector JsonSimdIsNotWhitespace(JsonSimdVector v) {
+  if constexpr (sizeof(Char) == 1) {
+    return vmvnq_u8(
+        vorrq_u8(vorrq_u8(vceqq_u8(v, vdupq_n_u8(' ')),
+                          vceqq_u8(v, vdupq_n_u8('\t'))),
+                 vorrq_u8(vceqq_u8(v, vdupq_n_u8('\n')),
+                          vceqq_u8(v, vdupq_n_u8('\r')))));
+  } else {
+    uint16x8_t w = vreinterpretq_u16_u8(v);
+    return vreinterpretq_u8_u16(vmvnq_u16(
+        vorrq_u16(vorrq_u16(vceqq_u16(w, vdupq_n_u16(' ')),
+                            vceqq_u16(w, vdupq_n_u16('\t'))),
+                  vorrq_u16(vceqq_u16(w, vdupq_n_u16('\n')),
+                            vceqq_u16(w, vdupq_n_u16('\r'))))));
+  }
+}
+
+template <typename Char>
+V8_INLINE JsonSimdVector JsonSimdIsNotDecimalDigit(JsonSimdVector v) {
+  if constexpr (sizeof(Char) == 1) {
+    return vcgtq_u8(vsubq_u8(v, vdupq_n_u8('0')), vdupq_n_u8(9));
+  } else {
+    uint16x8_t w = vreinterpretq_u16_u8(v);
+    return vreinterpretq_u8_u16(
+        vcgtq_u16(vsubq_u16(w, vdupq_n_u16('0')), vdupq_n_u16(9)));
+  }
+}
+
+// Narrows each byte of |mask| to a nibble (the "shrn" trick) so that the first
+// set lane can be found with a single count-trailing-zeros.
+template <typename Char>
+V8_INLINE size_t JsonSimdFirstSetLane(JsonSimdVector mask) {
+  uint64_t bits = vget_lane_u64(
+      vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(mask), 4)), 0);
+  if (bits == 0) return kJsonSimdBytes / sizeof(Char);
+  return base::bits::CountTrailingZeros64(bits) / (4 * sizeof(Char));
+}
+
+V8_INLINE JsonSimdVector JsonSimdIsNonAscii(JsonSimdVector v) {
+  return vcgtq_u8(v, vdupq_n_u8(unibrow::Utf8::kMaxOneByteChar));
+}
+
+V8_INLINE bool JsonSimdHasNonLatin1(JsonSimdVector v) {
+  return vmaxvq_u16(vreinterpretq_u16_u8(v)) > unibrow::Latin1::kMaxChar;
+}
+
+#endif  // V8_JSON_SIMD_NEON
+
+// Returns a pointer to the first character in [cursor, end) for which
+// |matcher| sets the lane, or to the start of the remaining tail once fewer
+// than a full vector of characters is left.
+template <typename Char, typename Matcher>
+V8_INLINE const Char* JsonSimdFind(const Char* cursor, const Char* end,
+                                   Matcher matcher) {
+  constexpr size_t kLanes = kJsonSimdBytes / sizeof(Char);
+  while (static_cast<size_t>(end - cursor) >= kLanes) {
+    size_t index =
+        JsonSimdFirstSetLane<Char>(matcher(JsonSimdLoad<Char>(cursor)));
+    if (index < kLanes) return cursor + index;
+    cursor += kLanes;
+  }
+  return cursor;
+}
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_JSON_SIMD
+
+#endif  // V8_JSON_JSON_SIMD_H_
@@ -8,6 +8,7 @@
 #include "src/common/assert-scope.h"
 #include "src/common/message-template.h"
 #include "src/execution/protectors-inl.h"
+#include "src/json/json-simd.h"
 #include "src/numbers/conversions.h"
 #include "src/objects/elements-kind.h"
 #include "src/objects/heap-number-inl.h"
@@ -19,7 +20,9 @@
 #include "src/objects/ordered-hash-table.h"
 #include "src/objects/smi.h"
 #include "src/objects/tagged.h"
+#include "src/profiler/output-stream-writer.h"
 #include "src/strings/string-builder-inl.h"
+#include "src/strings/unicode-inl.h"
 
 namespace v8 {
 namespace internal {
@@ -38,8 +41,17 @@ class JsonStringifier {
                                                       Handle<Object> replacer,
                                                       Handle<Object> gap);
 
+  // Serializes |object| as UTF-8 into |stream|, handing the output over in
+  // chunks whenever the buffer fills up instead of growing the buffer.
+  // Returns false if the embedder aborted the stream.
+  V8_WARN_UNUSED_RESULT Maybe<bool> StringifyToStream(
+      Handle<Object> object, Handle<Object> gap, v8::OutputStream* stream);
+
  private:
-  enum Result { UNCHANGED, SUCCESS, EXCEPTION, NEED_STACK };
+  // ABORTED is only returned by StringifyToStream's serialization, once the
+  // embedder has aborted the stream and the rest of the output would be
+  // dropped anyway.
+  enum Result { UNCHANGED, SUCCESS, EXCEPTION, NEED_STACK, ABORTED };
 
   bool InitializeReplacer(Handle<Object> replacer);
   bool InitializeGap(Handle<Object> gap);
@@ -246,8 +258,10 @@ class JsonStringifier {
     // Appends all of the chars from the provided span, but only increases the
     // cursor by `length`. This allows oversizing the span to the nearest
     // convenient multiple, allowing CopyChars to run slightly faster.
-    V8_INLINE void AppendChars(base::Vector<const uint8_t> chars,
+    template <typename SrcChar>
+    V8_INLINE void AppendChars(base::Vector<const SrcChar> chars,
                                size_t length) {
+      static_assert(sizeof(DestChar) >= sizeof(SrcChar));
       DCHECK_GE(chars.size(), length);
       CopyChars(cursor_, chars.begin(), chars.size());
       cursor_ += length;
@@ -342,6 +356,12 @@ class JsonStringifier {
   template <typename Char>
   V8_INLINE static bool DoNotEscape(Char c);
 
+  // Returns the index of the first character at or after `start` that needs
+  // escaping, or the length of `src` if there is none.
+  template <typename Char>
+  V8_INLINE static int FindCharacterToEscape(base::Vector<const Char> src,
+                                             int start);
+
   V8_INLINE void NewLine();
   V8_NOINLINE void NewLineOutline();
   V8_INLINE void Indent() { indent_++; }
@@ -372,6 +392,16 @@ class JsonStringifier {
   V8_NOINLINE void Extend();
   V8_NOINLINE void ChangeEncoding();
 
+  // Writes the buffered output to stream_writer_ and empties the buffer,
+  // except for a trailing lead surrogate that is kept back until its trail
+  // surrogate has been serialized.
+  void FlushToStream();
+  bool StreamAborted() {
+    return stream_writer_ != nullptr && stream_writer_->aborted();
+  }
+  template <typename Char>
+  void WriteUtf8ToStream(const Char* chars, int length);
+
   Isolate* isolate_;
   String::Encoding encoding_;
   Handle<FixedArray> property_list_;
@@ -386,6 +416,7 @@ class JsonStringifier {
   int stack_nesting_level_;
   bool overflowed_;
   bool need_stack_;
+  OutputStreamWriter* stream_writer_;
 
   using KeyObject = std::pair<Handle<Object>, Handle<Object>>;
   std::vector<KeyObject> stack_;
@@ -404,6 +435,13 @@ MaybeHandle<Object> JsonStringify(Isolate* isolate, Handle<Object> object,
   return stringifier.Stringify(object, replacer, gap);
 }
 
+Maybe<bool> JsonStringifyToStream(Isolate* isolate, Handle<Object> object,
+                                  Handle<Object> gap,
+                                  v8::OutputStream* stream) {
+  JsonStringifier stringifier(isolate);
+  return stringifier.StringifyToStream(object, gap, stream);
+}
+
 // Translation table to escape Latin1 characters.
 // Table entries start at a multiple of 8 and are null-terminated.
 const char* const JsonStringifier::JsonEscapeTable =
@@ -457,6 +495,7 @@ JsonStringifier::JsonStringifier(Isolate* isolate)
       stack_nesting_level_(0),
       overflowed_(false),
       need_stack_(false),
+      stream_writer_(nullptr),
       stack_(),
       key_cache_(isolate) {
   one_byte_ptr_ = one_byte_array_;
@@ -500,6 +539,38 @@ MaybeHandle<Object> JsonStringifier::Stringify(Handle<Object> object,
   return MaybeHandle<Object>();
 }
 
+Maybe<bool> JsonStringifier::StringifyToStream(Handle<Object> object,
+                                               Handle<Object> gap,
+                                               v8::OutputStream* stream) {
+  if (!IsUndefined(*gap, isolate_) && !InitializeGap(gap)) {
+    CHECK(isolate_->has_exception());
+    return Nothing<bool>();
+  }
+  OutputStreamWriter writer(stream);
+  stream_writer_ = &writer;
+  // Output that has been flushed to the stream cannot be taken back, so we
+  // cannot restart on NEED_STACK and have to track the stack from the start.
+  need_stack_ = true;
+  Result result = SerializeObject(object);
+  if (result == EXCEPTION) {
+    CHECK(isolate_->has_exception());
+    stream_writer_ = nullptr;
+    return Nothing<bool>();
+  }
+  DCHECK(result != NEED_STACK);
+  if (result == ABORTED) {
+    stream_writer_ = nullptr;
+    return Just(false);
+  }
+  // Match JSON::Stringify, which converts an undefined result to a string.
+  if (result == UNCHANGED) AppendCStringLiteral("undefined");
+  FlushToStream();
+  DCHECK_EQ(current_index_, 0);
+  stream_writer_ = nullptr;
+  writer.Finalize();
+  return Just(!writer.aborted());
+}
+
 bool JsonStringifier::InitializeReplacer(Handle<Object> replacer) {
   DCHECK(property_list_.is_null());
   DCHECK(replacer_function_.is_null());
@@ -814,6 +885,8 @@ JsonStringifier::Result JsonStringifier::Serialize_(Handle<Object> object,
       IsException(isolate_->stack_guard()->HandleInterrupts(), isolate_)) {
     return EXCEPTION;
   }
+  // Don't call toJSON or the replacer for output nobody receives.
+  if (V8_UNLIKELY(StreamAborted())) return ABORTED;
 
   Handle<Object> initial_value = object;
   PtrComprCageBase cage_base(isolate_);
@@ -1097,6 +1170,7 @@ JsonStringifier::Result JsonStringifier::SerializeFixedArrayWithInterruptCheck(
       }
     }
     if (i >= length) return SUCCESS;
+    if (V8_UNLIKELY(StreamAborted())) return ABORTED;
     DCHECK_LT(limit, kMaxAllowedFastPackedLength);
     limit = std::min(length, limit + kInterruptLength);
     if (interrupt_check.InterruptRequested() &&
@@ -1299,7 +1373,9 @@ JsonStringifier::Result JsonStringifier::SerializeJSObject(
     }
     Result result = SerializeProperty(property, comma, key_name);
     if (!comma && result == SUCCESS) comma = true;
-    if (result == EXCEPTION || result == NEED_STACK) return result;
+    if (result == EXCEPTION || result == NEED_STACK || result == ABORTED) {
+      return result;
+    }
   }
   Unindent();
   if (comma) NewLine();
@@ -1330,7 +1406,9 @@ JsonStringifier::Result JsonStringifier::SerializeJSReceiverSlow(
         EXCEPTION);
     Result result = SerializeProperty(property, comma, key);
     if (!comma && result == SUCCESS) comma = true;
-    if (result == EXCEPTION || result == NEED_STACK) return result;
+    if (result == EXCEPTION || result == NEED_STACK || result == ABORTED) {
+      return result;
+    }
   }
   Unindent();
   if (comma) NewLine();
@@ -1381,14 +1459,24 @@ bool JsonStringifier::SerializeStringUnchecked_(
   // Assert that base::uc16 character is not truncated down to 8 bit.
   // The <base::uc16, char> version of this method must not be called.
   DCHECK(sizeof(DestChar) >= sizeof(SrcChar));
+  if constexpr (raw_json) {
+    dest->AppendChars(src, src.length());
+    return false;
+  }
   bool required_escaping = false;
   for (int i = 0; i < src.length(); i++) {
+    // Copy the run of characters that need no escaping in bulk.
+    int run_end = FindCharacterToEscape(src, i);
+    if (run_end > i) {
+      dest->AppendChars(src.SubVector(i, run_end), run_end - i);
+      i = run_end;
+      if (i == src.length()) break;
+    }
     SrcChar c = src[i];
-    if (raw_json || DoNotEscape(c)) {
-      dest->Append(c);
-    } else if (sizeof(SrcChar) != 1 &&
-               base::IsInRange(c, static_cast<SrcChar>(0xD800),
-                               static_cast<SrcChar>(0xDFFF))) {
+    DCHECK(!DoNotEscape(c));
+    if (sizeof(SrcChar) != 1 &&
+        base::IsInRange(c, static_cast<SrcChar>(0xD800),
+                        static_cast<SrcChar>(0xDFFF))) {
       // The current character is a surrogate.
       required_escaping = true;
       if (c <= 0xDBFF) {
@@ -1441,72 +1529,29 @@ bool JsonStringifier::SerializeStringUnchecked_(
 template <typename SrcChar, typename DestChar, bool raw_json>
 bool JsonStringifier::SerializeString_(Tagged<String> string,
                                        const DisallowGarbageCollection& no_gc) {
-  int length = string->length();
   bool required_escaping = false;
   if (!raw_json) Append<uint8_t, DestChar>('"');
-  // We might be able to fit the whole escaped string in the current string
-  // part, or we might need to allocate.
   base::Vector<const SrcChar> vector = string->GetCharVector<SrcChar>(no_gc);
-  if V8_LIKELY (EscapedLengthIfCurrentPartFits(length)) {
+  // Serialize the string in chunks that are small enough that the buffer can
+  // be grown up front to hold each chunk even if every character needs
+  // escaping. Most strings fit in a single chunk.
+  int start = 0;
+  while (start < vector.length()) {
+    int end = std::min(vector.length(), start + kMaxPartLength);
+    // Don't split surrogate pairs across chunks.
+    if (sizeof(SrcChar) != 1 && end < vector.length() &&
+        base::IsInRange(vector[end - 1], static_cast<SrcChar>(0xD800),
+                        static_cast<SrcChar>(0xDBFF))) {
+      end--;
+    }
+    while (!EscapedLengthIfCurrentPartFits(end - start)) Extend();
     NoExtendBuilder<DestChar> no_extend(
         reinterpret_cast<DestChar*>(part_ptr_) + current_index_,
         &current_index_);
-    required_escaping = SerializeStringUnchecked_<SrcChar, DestChar, raw_json>(
-        vector, &no_extend);
-  } else {
-    for (int i = 0; i < vector.length(); i++) {
-      SrcChar c = vector.at(i);
-      if (raw_json || DoNotEscape(c)) {
-        Append<SrcChar, DestChar>(c);
-      } else if (sizeof(SrcChar) != 1 &&
-                 base::IsInRange(c, static_cast<SrcChar>(0xD800),
-                                 static_cast<SrcChar>(0xDFFF))) {
-        // The current character is a surrogate.
-        required_escaping = true;
-        if (c <= 0xDBFF) {
-          // The current character is a leading surrogate.
-          if (i + 1 < vector.length()) {
-            // There is a next character.
-            SrcChar next = vector.at(i + 1);
-            if (base::IsInRange(next, static_cast<SrcChar>(0xDC00),
-                                static_cast<SrcChar>(0xDFFF))) {
-              // The next character is a trailing surrogate, meaning this is a
-              // surrogate pair.
-              Append<SrcChar, DestChar>(c);
-              Append<SrcChar, DestChar>(next);
-              i++;
-            } else {
-              // The next character is not a trailing surrogate. Thus, the
-              // current character is a lone leading surrogate.
-              AppendCStringLiteral("\\u");
-              char* const hex = DoubleToRadixCString(c, 16);
-              AppendCString(hex);
-              DeleteArray(hex);
-            }
-          } else {
-            // There is no next character. Thus, the current character is a
-            // lone leading surrogate.
-            AppendCStringLiteral("\\u");
-            char* const hex = DoubleToRadixCString(c, 16);
-            AppendCString(hex);
-            DeleteArray(hex);
-          }
-        } else {
-          // The current character is a lone trailing surrogate. (If it had
-          // been preceded by a leading surrogate, we would've ended up in the
-          // other branch earlier on, and the current character would've been
-          // handled as part of the surrogate pair already.)
-          AppendCStringLiteral("\\u");
-          char* const hex = DoubleToRadixCString(c, 16);
-          AppendCString(hex);
-          DeleteArray(hex);
-        }
-      } else {
-        DCHECK_LT(c, 0x60);
-        required_escaping = true;
-        AppendCString(&JsonEscapeTable[c * kJsonEscapeTableEntrySize]);
-      }
-    }
+    required_escaping |=
+        SerializeStringUnchecked_<SrcChar, DestChar, raw_json>(
+            vector.SubVector(start, end), &no_extend);
+    start = end;
   }
   if (!raw_json) Append<uint8_t, DestChar>('"');
   return required_escaping;
@@ -1572,6 +1617,18 @@ bool JsonStringifier::DoNotEscape(uint16_t c) {
          (c >= 0x23 && c != 0x5C && (c < 0xD800 || c > 0xDFFF));
 }
 
+template <typename Char>
+int JsonStringifier::FindCharacterToEscape(base::Vector<const Char> src,
+                                           int start) {
+  const Char* cursor = src.begin() + start;
+  const Char* end = src.end();
+#ifdef V8_JSON_SIMD
+  cursor = JsonSimdFind(cursor, end, JsonSimdNeedsEscaping<Char>);
+#endif  // V8_JSON_SIMD
+  while (cursor < end && DoNotEscape(*cursor)) cursor++;
+  return static_cast<int>(cursor - src.begin());
+}
+
 void JsonStringifier::NewLine() {
   if (gap_ == nullptr) return;
   NewLineOutline();
@@ -1632,6 +1689,11 @@ bool JsonStringifier::SerializeString(Handle<String> object) {
 }
 
 void JsonStringifier::Extend() {
+  if (stream_writer_ != nullptr) {
+    int buffered = current_index_;
+    FlushToStream();
+    if (current_index_ < buffered) return;
+  }
   if (part_length_ >= String::kMaxLength) {
     // Set the flag and carry on. Delay throwing the exception till the end.
     current_index_ = 0;
@@ -1647,9 +1709,7 @@ void JsonStringifier::Extend() {
     part_ptr_ = one_byte_ptr_;
   } else {
     base::uc16* tmp_ptr = new base::uc16[part_length_];
-    for (int i = 0; i < current_index_; i++) {
-      tmp_ptr[i] = two_byte_ptr_[i];
-    }
+    CopyChars(tmp_ptr, two_byte_ptr_, current_index_);
     delete[] two_byte_ptr_;
     two_byte_ptr_ = tmp_ptr;
     part_ptr_ = two_byte_ptr_;
@@ -1659,13 +1719,55 @@ void JsonStringifier::Extend() {
 void JsonStringifier::ChangeEncoding() {
   encoding_ = String::TWO_BYTE_ENCODING;
   two_byte_ptr_ = new base::uc16[part_length_];
-  for (int i = 0; i < current_index_; i++) {
-    two_byte_ptr_[i] = one_byte_ptr_[i];
-  }
+  CopyChars(two_byte_ptr_, one_byte_ptr_, current_index_);
   part_ptr_ = two_byte_ptr_;
   if (one_byte_ptr_ != one_byte_array_) delete[] one_byte_ptr_;
   one_byte_ptr_ = nullptr;
 }
 
+void JsonStringifier::FlushToStream() {
+  DCHECK_NOT_NULL(stream_writer_);
+  int length = current_index_;
+  if (encoding_ == String::ONE_BYTE_ENCODING) {
+    WriteUtf8ToStream(one_byte_ptr_, length);
+  } else {
+    if (length > 0 &&
+        unibrow::Utf16::IsLeadSurrogate(two_byte_ptr_[length - 1])) {
+      length--;
+    }
+    WriteUtf8ToStream(two_byte_ptr_, length);
+    if (length < current_index_) two_byte_ptr_[0] = two_byte_ptr_[length];
+  }
+  current_index_ -= length;
+}
+
+template <typename Char>
+void JsonStringifier::WriteUtf8ToStream(const Char* chars, int length) {
+  if (stream_writer_->aborted()) return;
+  static constexpr int kBufferSize = 1024;
+  char buffer[kBufferSize + unibrow::Utf8::kMaxEncodedSize];
+  int position = 0;
+  for (int i = 0; i < length; i++) {
+    unibrow::uchar c = chars[i];
+    if (c <= unibrow::Utf8::kMaxOneByteChar) {
+      buffer[position++] = static_cast<char>(c);
+    } else {
+      if (sizeof(Char) != 1 && unibrow::Utf16::IsLeadSurrogate(c) &&
+          i + 1 < length && unibrow::Utf16::IsTrailSurrogate(chars[i + 1])) {
+        c = unibrow::Utf16::CombineSurrogatePair(c, chars[++i]);
+      }
+      position += unibrow::Utf8::Encode(buffer + position, c,
+                                        unibrow::Utf16::kNoPreviousCharacter);
+    }
+    if (position >= kBufferSize) {
+      stream_writer_->AddBytes(buffer, position);
+      position = 0;
+    }
+  }
+  if (position > 0) {
+    stream_writer_->AddBytes(buffer, position);
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
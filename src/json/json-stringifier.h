@@ -8,12 +8,21 @@
 #include "src/objects/objects.h"
 
 namespace v8 {
+
+class OutputStream;
+
 namespace internal {
 
 V8_WARN_UNUSED_RESULT MaybeHandle<Object> JsonStringify(Isolate* isolate,
                                                         Handle<Object> object,
                                                         Handle<Object> replacer,
                                                         Handle<Object> gap);
+
+// Serializes |object| like JSON.stringify without a replacer, but writes the
+// result as UTF-8 into |stream| in chunks rather than creating a string.
+V8_WARN_UNUSED_RESULT Maybe<bool> JsonStringifyToStream(
+    Isolate* isolate, Handle<Object> object, Handle<Object> gap,
+    v8::OutputStream* stream);
 }  // namespace internal
 }  // namespace v8
 
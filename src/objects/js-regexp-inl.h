@@ -51,6 +51,21 @@ int JSRegExp::max_register_count() const {
   return Smi::ToInt(DataAt(kIrregexpMaxRegisterCountIndex));
 }
 
+Tagged<Object> JSRegExp::prefilter() const {
+  DCHECK_EQ(type_tag(), IRREGEXP);
+  return DataAt(kIrregexpPrefilterIndex);
+}
+
+Tagged<Object> JSRegExp::experimental_dfa() const {
+  DCHECK_EQ(type_tag(), EXPERIMENTAL);
+  return DataAt(kExperimentalDfaIndex);
+}
+
+void JSRegExp::set_experimental_dfa(Tagged<Object> dfa) {
+  DCHECK_EQ(type_tag(), EXPERIMENTAL);
+  SetDataAt(kExperimentalDfaIndex, dfa);
+}
+
 Tagged<String> JSRegExp::atom_pattern() const {
   DCHECK_EQ(type_tag(), ATOM);
   return String::cast(DataAt(JSRegExp::kAtomPatternIndex));
@@ -133,6 +148,9 @@ void JSRegExp::DiscardCompiledCodeForSerialization() {
   SetDataAt(kIrregexpUC16CodeIndex, uninitialized);
   SetDataAt(kIrregexpLatin1BytecodeIndex, uninitialized);
   SetDataAt(kIrregexpUC16BytecodeIndex, uninitialized);
+  if (type_tag() == EXPERIMENTAL) {
+    SetDataAt(kExperimentalDfaIndex, uninitialized);
+  }
 }
 
 }  // namespace internal
@@ -82,6 +82,12 @@ class JSRegExp : public TorqueGeneratedJSRegExp<JSRegExp, JSObject> {
   inline Tagged<Object> capture_name_map();
   inline void set_capture_name_map(Handle<FixedArray> capture_name_map);
   uint32_t backtrack_limit() const;
+  // This could be a Smi kUninitializedValue or String.
+  inline Tagged<Object> prefilter() const;
+  // This could be a Smi kUninitializedValue or
+  // Managed<ExperimentalRegExpDfa>.
+  inline Tagged<Object> experimental_dfa() const;
+  inline void set_experimental_dfa(Tagged<Object> dfa);
 
   static constexpr Flag AsJSRegExpFlag(RegExpFlag f) {
     return static_cast<Flag>(f);
@@ -209,7 +215,11 @@ class JSRegExp : public TorqueGeneratedJSRegExp<JSRegExp, JSObject> {
   // above to save space.
   static constexpr int kIrregexpBacktrackLimit =
       kIrregexpTicksUntilTierUpIndex + 1;
-  static constexpr int kIrregexpDataSize = kIrregexpBacktrackLimit + 1;
+  // A String that every match starts with, or a Smi marker value equal to
+  // kUninitializedValue. Used to skip ahead to candidate match positions
+  // before entering irregexp code.
+  static constexpr int kIrregexpPrefilterIndex = kIrregexpBacktrackLimit + 1;
+  static constexpr int kIrregexpDataSize = kIrregexpPrefilterIndex + 1;
 
   // TODO(mbid,v8:10765): At the moment the EXPERIMENTAL data array conforms
   // to the format of an IRREGEXP data array, with most fields set to some
@@ -218,7 +228,11 @@ class JSRegExp : public TorqueGeneratedJSRegExp<JSRegExp, JSObject> {
   // various fields from the data array. `RegExpExecInternal` should probably
   // distinguish between EXPERIMENTAL and IRREGEXP, and then we can get rid of
   // all the IRREGEXP only fields.
-  static constexpr int kExperimentalDataSize = kIrregexpDataSize;
+  // A Managed<ExperimentalRegExpDfa> created when the bytecode is compiled, or
+  // a Smi marker value equal to kUninitializedValue if the regexp isn't
+  // compiled yet or its bytecode isn't supported by the lazy DFA.
+  static constexpr int kExperimentalDfaIndex = kIrregexpDataSize;
+  static constexpr int kExperimentalDataSize = kExperimentalDfaIndex + 1;
 
   // In-object fields.
   static constexpr int kLastIndexFieldIndex = 0;
@@ -18,18 +18,23 @@ namespace internal {
 template <class Derived, int entrysize>
 MaybeHandle<Derived> OrderedHashTable<Derived, entrysize>::Allocate(
     Isolate* isolate, int capacity, AllocationType allocation) {
-  // Capacity must be a power of two, since we depend on being able
-  // to divide and multiple by 2 (kLoadFactor) to derive capacity
-  // from number of buckets. If we decide to change kLoadFactor
-  // to something other than 2, capacity should be stored as another
-  // field of this object.
-  capacity =
-      base::bits::RoundUpToPowerOfTwo32(std::max({kInitialCapacity, capacity}));
+  static_assert(CapacityForBuckets(kInitialNumberOfBuckets) ==
+                kInitialCapacity);
+  // The largest table has twice as many buckets as entries.
+  static_assert(HashTableStartIndex() + 2 * MaxCapacity() +
+                    MaxCapacity() * kEntrySize <=
+                FixedArray::kMaxLength);
+  capacity = std::max({kInitialCapacity, capacity});
   if (capacity > MaxCapacity()) {
     THROW_NEW_ERROR_RETURN_VALUE(
         isolate, NewRangeError(MessageTemplate::kTooManyProperties), {});
   }
-  int num_buckets = capacity / kLoadFactor;
+  // The number of buckets has to be a power of two to select the first bucket
+  // from the hash. Pick the smallest one that leaves room for |capacity|
+  // entries, the capacity is derived from it.
+  int num_buckets = base::bits::RoundUpToPowerOfTwo32(capacity);
+  if (CapacityForBuckets(num_buckets) < capacity) num_buckets *= 2;
+  capacity = CapacityForBuckets(num_buckets);
   Handle<FixedArray> backing_store = isolate->factory()->NewFixedArrayWithMap(
       Derived::GetMap(ReadOnlyRoots(isolate)),
       HashTableStartIndex() + num_buckets + (capacity * kEntrySize),
@@ -88,6 +93,10 @@ OrderedHashTable<Derived, entrysize>::EnsureCapacityForAdding(
     new_capacity = capacity;
   } else {
     new_capacity = capacity << 1;
+    // The largest table has fewer than twice the capacity of the one before.
+    if (capacity < MaxCapacity()) {
+      new_capacity = std::min(new_capacity, MaxCapacity());
+    }
   }
 
   return Derived::Rehash(isolate, table, new_capacity);
@@ -145,29 +154,24 @@ InternalIndex OrderedHashTable<Derived, entrysize>::FindEntry(
     return InternalIndex::NotFound();
   }
 
-  int raw_entry;
+  int hash;
   // This special cases for Smi, so that we avoid the HandleScope
   // creation below.
   if (IsSmi(key)) {
-    uint32_t hash = ComputeUnseededHash(Smi::ToInt(key));
-    raw_entry = HashToEntryRaw(hash & Smi::kMaxValue);
+    hash = ComputeUnseededHash(Smi::ToInt(key)) & Smi::kMaxValue;
   } else {
     HandleScope scope(isolate);
-    Tagged<Object> hash = Object::GetHash(key);
+    Tagged<Object> raw_hash = Object::GetHash(key);
     // If the object does not have an identity hash, it was never used as a key
-    if (IsUndefined(hash, isolate)) return InternalIndex::NotFound();
-    raw_entry = HashToEntryRaw(Smi::ToInt(hash));
+    if (IsUndefined(raw_hash, isolate)) return InternalIndex::NotFound();
+    hash = Smi::ToInt(raw_hash);
   }
 
-  // Walk the chain in the bucket to find the key.
-  while (raw_entry != kNotFound) {
-    Tagged<Object> candidate_key = KeyAt(InternalIndex(raw_entry));
-    if (Object::SameValueZero(candidate_key, key))
-      return InternalIndex(raw_entry);
-    raw_entry = NextChainEntryRaw(raw_entry);
-  }
-
-  return InternalIndex::NotFound();
+  int raw_entry = FindEntryRaw(hash, [key](Tagged<Object> candidate_key) {
+    return Object::SameValueZero(candidate_key, key);
+  });
+  if (raw_entry == kNotFound) return InternalIndex::NotFound();
+  return InternalIndex(raw_entry);
 }
 
 MaybeHandle<OrderedHashSet> OrderedHashSet::Add(Isolate* isolate,
@@ -180,15 +184,12 @@ MaybeHandle<OrderedHashSet> OrderedHashSet::Add(Isolate* isolate,
     Tagged<OrderedHashSet> raw_table = *table;
     hash = Object::GetOrCreateHash(raw_key, isolate).value();
     if (raw_table->NumberOfElements() > 0) {
-      int raw_entry = raw_table->HashToEntryRaw(hash);
-      // Walk the chain of the bucket and try finding the key.
-      while (raw_entry != kNotFound) {
-        Tagged<Object> candidate_key =
-            raw_table->KeyAt(InternalIndex(raw_entry));
-        // Do not add if we have the key already
-        if (Object::SameValueZero(candidate_key, raw_key)) return table;
-        raw_entry = raw_table->NextChainEntryRaw(raw_entry);
-      }
+      int raw_entry = raw_table->FindEntryRaw(
+          hash, [raw_key](Tagged<Object> candidate_key) {
+            return Object::SameValueZero(candidate_key, raw_key);
+          });
+      // Do not add if we have the key already
+      if (raw_entry != kNotFound) return table;
     }
   }
 
@@ -200,17 +201,13 @@ MaybeHandle<OrderedHashSet> OrderedHashSet::Add(Isolate* isolate,
   }
   DisallowGarbageCollection no_gc;
   Tagged<OrderedHashSet> raw_table = *table;
-  // Read the existing bucket values.
-  int bucket = raw_table->HashToBucket(hash);
-  int previous_entry = raw_table->HashToEntryRaw(hash);
   int nof = raw_table->NumberOfElements();
   // Insert a new entry at the end,
   int new_entry = nof + raw_table->NumberOfDeletedElements();
   int new_index = raw_table->EntryToIndexRaw(new_entry);
   raw_table->set(new_index, *key);
-  raw_table->set(new_index + kChainOffset, Smi::FromInt(previous_entry));
-  // and point the bucket to the new entry.
-  raw_table->set(HashTableStartIndex() + bucket, Smi::FromInt(new_entry));
+  // and point a bucket to the new entry.
+  raw_table->InsertIntoHashTable(hash, new_entry);
   raw_table->SetNumberOfElements(nof + 1);
   return table;
 }
@@ -273,7 +270,6 @@ MaybeHandle<Derived> OrderedHashTable<Derived, entrysize>::Rehash(
   if (!new_table_candidate.ToHandle(&new_table)) {
     return new_table_candidate;
   }
-  int new_buckets = new_table->NumberOfBuckets();
   int new_entry = 0;
   int removed_holes_index = 0;
 
@@ -288,16 +284,13 @@ MaybeHandle<Derived> OrderedHashTable<Derived, entrysize>::Rehash(
     }
 
     Tagged<Object> hash = Object::GetHash(key);
-    int bucket = Smi::ToInt(hash) & (new_buckets - 1);
-    Tagged<Object> chain_entry = new_table->get(HashTableStartIndex() + bucket);
-    new_table->set(HashTableStartIndex() + bucket, Smi::FromInt(new_entry));
+    new_table->InsertIntoHashTable(Smi::ToInt(hash), new_entry);
     int new_index = new_table->EntryToIndexRaw(new_entry);
     int old_index = table->EntryToIndexRaw(old_entry_raw);
     for (int i = 0; i < entrysize; ++i) {
       Tagged<Object> value = table->get(old_index + i);
       new_table->set(new_index + i, value);
     }
-    new_table->set(new_index + kChainOffset, chain_entry);
     ++new_entry;
   }
 
@@ -386,18 +379,14 @@ MaybeHandle<OrderedHashMap> OrderedHashMap::Add(Isolate* isolate,
                                                 Handle<Object> value) {
   int hash = Object::GetOrCreateHash(*key, isolate).value();
   if (table->NumberOfElements() > 0) {
-    int raw_entry = table->HashToEntryRaw(hash);
-    // Walk the chain of the bucket and try finding the key.
-    {
-      DisallowGarbageCollection no_gc;
-      Tagged<Object> raw_key = *key;
-      while (raw_entry != kNotFound) {
-        Tagged<Object> candidate_key = table->KeyAt(InternalIndex(raw_entry));
-        // Do not add if we have the key already
-        if (Object::SameValueZero(candidate_key, raw_key)) return table;
-        raw_entry = table->NextChainEntryRaw(raw_entry);
-      }
-    }
+    DisallowGarbageCollection no_gc;
+    Tagged<Object> raw_key = *key;
+    int raw_entry =
+        table->FindEntryRaw(hash, [raw_key](Tagged<Object> candidate_key) {
+          return Object::SameValueZero(candidate_key, raw_key);
+        });
+    // Do not add if we have the key already
+    if (raw_entry != kNotFound) return table;
   }
 
   MaybeHandle<OrderedHashMap> table_candidate =
@@ -407,18 +396,14 @@ MaybeHandle<OrderedHashMap> OrderedHashMap::Add(Isolate* isolate,
   }
   DisallowGarbageCollection no_gc;
   Tagged<OrderedHashMap> raw_table = *table;
-  // Read the existing bucket values.
-  int bucket = raw_table->HashToBucket(hash);
-  int previous_entry = raw_table->HashToEntryRaw(hash);
   int nof = raw_table->NumberOfElements();
   // Insert a new entry at the end,
   int new_entry = nof + raw_table->NumberOfDeletedElements();
   int new_index = raw_table->EntryToIndexRaw(new_entry);
   raw_table->set(new_index, *key);
   raw_table->set(new_index + kValueOffset, *value);
-  raw_table->set(new_index + kChainOffset, Smi::FromInt(previous_entry));
-  // and point the bucket to the new entry.
-  raw_table->set(HashTableStartIndex() + bucket, Smi::FromInt(new_entry));
+  // and point a bucket to the new entry.
+  raw_table->InsertIntoHashTable(hash, new_entry);
   raw_table->SetNumberOfElements(nof + 1);
   return table;
 }
@@ -445,21 +430,14 @@ InternalIndex OrderedNameDictionary::FindEntry(IsolateT* isolate,
     return InternalIndex::NotFound();
   }
 
-  int raw_entry = HashToEntryRaw(raw_key->hash());
-  while (raw_entry != kNotFound) {
-    InternalIndex entry(raw_entry);
-    Tagged<Object> candidate_key = KeyAt(entry);
-    DCHECK(IsHashTableHole(candidate_key) ||
-           IsUniqueName(Name::cast(candidate_key)));
-    if (candidate_key == raw_key) return entry;
-
-    // TODO(gsathya): This is loading the bucket count from the hash
-    // table for every iteration. This should be peeled out of the
-    // loop.
-    raw_entry = NextChainEntryRaw(raw_entry);
-  }
-
-  return InternalIndex::NotFound();
+  int raw_entry =
+      FindEntryRaw(raw_key->hash(), [raw_key](Tagged<Object> candidate_key) {
+        DCHECK(IsHashTableHole(candidate_key) ||
+               IsUniqueName(Name::cast(candidate_key)));
+        return candidate_key == raw_key;
+      });
+  if (raw_entry == kNotFound) return InternalIndex::NotFound();
+  return InternalIndex(raw_entry);
 }
 
 MaybeHandle<OrderedNameDictionary> OrderedNameDictionary::Add(
@@ -475,10 +453,7 @@ MaybeHandle<OrderedNameDictionary> OrderedNameDictionary::Add(
   }
   DisallowGarbageCollection no_gc;
   Tagged<OrderedNameDictionary> raw_table = *table;
-  // Read the existing bucket values.
   int hash = key->hash();
-  int bucket = raw_table->HashToBucket(hash);
-  int previous_entry = raw_table->HashToEntryRaw(hash);
   int nof = raw_table->NumberOfElements();
   // Insert a new entry at the end,
   int new_entry = nof + raw_table->NumberOfDeletedElements();
@@ -491,9 +466,8 @@ MaybeHandle<OrderedNameDictionary> OrderedNameDictionary::Add(
   // (by not doing the Smi conversion).
   raw_table->set(new_index + kPropertyDetailsOffset, details.AsSmi());
 
-  raw_table->set(new_index + kChainOffset, Smi::FromInt(previous_entry));
-  // and point the bucket to the new entry.
-  raw_table->set(HashTableStartIndex() + bucket, Smi::FromInt(new_entry));
+  // and point a bucket to the new entry.
+  raw_table->InsertIntoHashTable(hash, new_entry);
   raw_table->SetNumberOfElements(nof + 1);
   return table;
 }
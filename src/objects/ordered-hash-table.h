@@ -5,6 +5,8 @@
 #ifndef V8_OBJECTS_ORDERED_HASH_TABLE_H_
 #define V8_OBJECTS_ORDERED_HASH_TABLE_H_
 
+#include <algorithm>
+
 #include "src/base/export-template.h"
 #include "src/common/globals.h"
 #include "src/objects/fixed-array.h"
@@ -37,16 +39,26 @@ namespace internal {
 //   [kPrefixSize + 1]: deleted element count
 //   [kPrefixSize + 2]: bucket count
 //   [kPrefixSize + 3..(kPrefixSize + 3 + NumberOfBuckets() - 1)]: "hash table",
-//                            where each item is an offset into the
-//                            data table (see below) where the first
-//                            item in this bucket is stored.
+//                            an open addressed table where each bucket is
+//                            either kNotFound or a Smi that holds the index
+//                            of an entry in the data table (see below) and
+//                            a few more bits of the hash of its key.
 //   [kPrefixSize + 3 + NumberOfBuckets()..length]: "data table", an
 //                            array of length Capacity() * kEntrySize,
-//                            where the first entrysize items are
-//                            handled by the derived class and the
-//                            item at kChainOffset is another entry
-//                            into the data table indicating the next
-//                            entry in this hash bucket.
+//                            where the entrysize items are handled by the
+//                            derived class.
+//
+// The data table keeps the entries in insertion order, and deleted entries
+// stay in place (with their key replaced by the hole) until the table is
+// rehashed. Lookups probe the hash table linearly, starting at the bucket
+// selected by the low bits of the hash, and only load keys from the data table
+// for buckets whose hash tag matches. The number of buckets is a power of two
+// and the data table has room for three entries per four buckets (see
+// CapacityForBuckets()), so the hash table is at most three quarters full and
+// every probe sequence ends at an empty bucket. Compared to chaining the
+// entries of a bucket through the data table, a lookup in a large table
+// touches one or two cache lines of the hash table and at most one entry,
+// instead of every entry in the chain.
 //
 // When we transition the table to a new version we obsolete it and reuse parts
 // of the memory to store information how to transition an iterator to the new
@@ -108,7 +120,7 @@ class OrderedHashTable : public FixedArray {
     return NumberOfElements() + NumberOfDeletedElements();
   }
 
-  int Capacity() { return NumberOfBuckets() * kLoadFactor; }
+  int Capacity() { return CapacityForBuckets(NumberOfBuckets()); }
 
   int NumberOfBuckets() const {
     return Smi::ToInt(get(NumberOfBucketsIndex()));
@@ -139,15 +151,13 @@ class OrderedHashTable : public FixedArray {
     return Smi::ToInt(get(RemovedHolesIndex() + index));
   }
 
-  // The extra +1 is for linking the bucket chains together.
-  static const int kEntrySize = entrysize + 1;
-  static const int kEntrySizeWithoutChain = entrysize;
-  static const int kChainOffset = entrysize;
+  static const int kEntrySize = entrysize;
 
   static const int kNotFound = -1;
   // The minimum capacity. Note that despite this value, 0 is also a permitted
   // capacity, indicating a table without any storage for elements.
-  static const int kInitialCapacity = 4;
+  static const int kInitialCapacity = 3;
+  static const int kInitialNumberOfBuckets = 4;
 
   static constexpr int PrefixIndex() { return 0; }
 
@@ -190,15 +200,35 @@ class OrderedHashTable : public FixedArray {
     return FixedArray::OffsetOfElementAt(HashTableStartIndex());
   }
 
-  static const int kLoadFactor = 2;
+  // Buckets hold the index of the entry in their upper bits and
+  // HashToTag(hash) in their lower kHashTagBits bits, so that most mismatching
+  // entries can be skipped without loading their key.
+  static const int kHashTagBits = 6;
+  static const int kHashTagMask = (1 << kHashTagBits) - 1;
+  static const uint32_t kHashTagMultiplier = 0x9E3779B1u;
 
   // NumberOfDeletedElements is set to kClearedTableSentinel when
   // the table is cleared, which allows iterator transitions to
   // optimize that case.
   static const int kClearedTableSentinel = -1;
   static constexpr int MaxCapacity() {
-    return (FixedArray::kMaxLength - HashTableStartIndex()) /
-           (1 + (kEntrySize * kLoadFactor));
+    // Entry indices have to fit into a bucket next to the hash tag, which
+    // leaves 30 - kHashTagBits bits in a 31 bit Smi.
+    static_assert(Smi::kMaxValue >= (1 << 30) - 1);
+    return 1 << (30 - kHashTagBits);
+  }
+
+  // Returns the capacity of a table with |number_of_buckets| buckets, which
+  // is three quarters of the buckets, up to MaxCapacity().
+  static constexpr int CapacityForBuckets(int number_of_buckets) {
+    return std::min(number_of_buckets - number_of_buckets / 4, MaxCapacity());
+  }
+
+  // Returns the hash tag of |hash|. Keys that start probing at the same bucket
+  // share the low bits of their hash, so the tag is computed from all of them.
+  static int HashToTag(int hash) {
+    return (static_cast<uint32_t>(hash) * kHashTagMultiplier) >>
+           (32 - kHashTagBits);
   }
 
  protected:
@@ -215,20 +245,32 @@ class OrderedHashTable : public FixedArray {
   static MaybeHandle<Derived> Rehash(Isolate* isolate, Handle<Derived> table,
                                      int new_capacity);
 
-  int HashToEntryRaw(int hash) {
+  // Returns the index of the first entry whose key has the given |hash| and
+  // satisfies |match|, or kNotFound. Deleted entries are never matched, since
+  // no key is equal to the hole.
+  template <typename Match>
+  int FindEntryRaw(int hash, Match match) {
+    DCHECK_GT(NumberOfBuckets(), 0);
+    int tag = HashToTag(hash);
+    for (int bucket = HashToBucket(hash);; bucket = NextBucket(bucket)) {
+      int value = Smi::ToInt(get(HashTableStartIndex() + bucket));
+      if (value == kNotFound) return kNotFound;
+      if ((value & kHashTagMask) != tag) continue;
+      int entry = value >> kHashTagBits;
+      DCHECK_LT(entry, UsedCapacity());
+      if (match(KeyAt(InternalIndex(entry)))) return entry;
+    }
+  }
+
+  // Stores |entry| in the first empty bucket of the probe sequence for |hash|.
+  void InsertIntoHashTable(int hash, int entry) {
+    DCHECK_LT(entry, Capacity());
     int bucket = HashToBucket(hash);
-    Tagged<Object> entry = this->get(HashTableStartIndex() + bucket);
-    int entry_int = Smi::ToInt(entry);
-    DCHECK(entry_int == kNotFound || entry_int >= 0);
-    return entry_int;
-  }
-
-  int NextChainEntryRaw(int entry) {
-    DCHECK_LT(entry, this->UsedCapacity());
-    Tagged<Object> next_entry = get(EntryToIndexRaw(entry) + kChainOffset);
-    int next_entry_int = Smi::ToInt(next_entry);
-    DCHECK(next_entry_int == kNotFound || next_entry_int >= 0);
-    return next_entry_int;
+    while (Smi::ToInt(get(HashTableStartIndex() + bucket)) != kNotFound) {
+      bucket = NextBucket(bucket);
+    }
+    set(HashTableStartIndex() + bucket,
+        Smi::FromInt((entry << kHashTagBits) | HashToTag(hash)));
   }
 
   // Returns an index into |this| for the given entry.
@@ -242,6 +284,8 @@ class OrderedHashTable : public FixedArray {
 
   int HashToBucket(int hash) { return hash & (NumberOfBuckets() - 1); }
 
+  int NextBucket(int bucket) { return (bucket + 1) & (NumberOfBuckets() - 1); }
+
   void SetNumberOfBuckets(int num) {
     set(NumberOfBucketsIndex(), Smi::FromInt(num));
   }
@@ -4,7 +4,10 @@
 
 #include "src/objects/string-table.h"
 
+#include <array>
 #include <atomic>
+#include <limits>
+#include <vector>
 
 #include "src/base/atomicops.h"
 #include "src/base/macros.h"
@@ -32,7 +35,8 @@ class StringTable::OffHeapStringHashSet
  public:
   static constexpr int kEntrySize = 1;
   static constexpr int kMaxEmptyFactor = 4;
-  static constexpr int kMinCapacity = 2048;
+  // All shards together start out with room for 2048 strings.
+  static constexpr int kMinCapacity = 2048 / StringTable::kShardCount;
 
   explicit OffHeapStringHashSet(int capacity)
       : OffHeapHashTableBase<OffHeapStringHashSet>(capacity) {}
@@ -157,23 +161,45 @@ void StringTable::Data::Print(PtrComprCageBase cage_base) const {
   os << "}" << std::endl;
 }
 
-StringTable::StringTable(Isolate* isolate)
-    : data_(Data::New(OffHeapStringHashSet::kMinCapacity).release()),
-      isolate_(isolate) {
+StringTable::StringTable(Isolate* isolate) : isolate_(isolate) {
   DCHECK_EQ(empty_element(), OffHeapStringHashSet::empty_element());
   DCHECK_EQ(deleted_element(), OffHeapStringHashSet::deleted_element());
+  for (Shard& shard : shards_) {
+    shard.data.store(Data::New(OffHeapStringHashSet::kMinCapacity).release(),
+                     std::memory_order_relaxed);
+  }
+}
+
+StringTable::~StringTable() {
+  for (Shard& shard : shards_) {
+    delete shard.data.load(std::memory_order_relaxed);
+  }
 }
 
-StringTable::~StringTable() { delete data_; }
+// static
+int StringTable::ShardIndex(uint32_t hash) {
+  // Use the upper bits of the hash, since the lower bits select the entry
+  // within the shard.
+  static_assert(kShardCountLog2 < Name::HashBits::kSize);
+  DCHECK(Name::HashBits::is_valid(hash));
+  return static_cast<int>(hash >> (Name::HashBits::kSize - kShardCountLog2));
+}
 
 int StringTable::Capacity() const {
-  return data_.load(std::memory_order_acquire)->table().capacity();
+  int capacity = 0;
+  for (const Shard& shard : shards_) {
+    capacity += shard.data.load(std::memory_order_acquire)->table().capacity();
+  }
+  return capacity;
 }
 int StringTable::NumberOfElements() const {
-  {
-    base::MutexGuard table_write_guard(&write_mutex_);
-    return data_.load(std::memory_order_relaxed)->table().number_of_elements();
+  int number_of_elements = 0;
+  for (const Shard& shard : shards_) {
+    base::MutexGuard table_write_guard(&shard.write_mutex);
+    Data* data = shard.data.load(std::memory_order_relaxed);
+    number_of_elements += data->table().number_of_elements();
   }
+  return number_of_elements;
 }
 
 // InternalizedStringKey carries a string/internalized-string object as key.
@@ -393,7 +419,7 @@ DirectHandle<String> StringTable::LookupKey(IsolateT* isolate,
   //
   //   - The Heap access is allowed to be concurrent (using LocalHeap or
   //     similar),
-  //   - All writes to the string table are guarded by the Isolate string table
+  //   - All writes to a string table shard are guarded by the shard's write
   //     mutex,
   //   - Resizes of the string table first copies the old contents to the new
   //     table, and only then sets the new string table pointer to the new
@@ -423,9 +449,12 @@ DirectHandle<String> StringTable::LookupKey(IsolateT* isolate,
   // allocation if another write also did an allocation. This assumes that
   // writes are rarer than reads.
 
+  // Only the shard the key hashes to is ever read or written below.
+  Shard& shard = ShardFor(key->hash());
+
   // Load the current string table data, in case another thread updates the
   // data while we're reading.
-  Data* const current_data = data_.load(std::memory_order_acquire);
+  Data* const current_data = shard.data.load(std::memory_order_acquire);
   OffHeapStringHashSet& current_table = current_data->table();
 
   // First try to find the string in the table. This is safe to do even if the
@@ -444,9 +473,9 @@ DirectHandle<String> StringTable::LookupKey(IsolateT* isolate,
   // No entry found, so adding new string.
   key->PrepareForInsertion(isolate);
   {
-    base::MutexGuard table_write_guard(&write_mutex_);
+    base::MutexGuard table_write_guard(&shard.write_mutex);
 
-    Data* data = EnsureCapacity(isolate, 1);
+    Data* data = EnsureCapacity(shard, isolate, 1);
     OffHeapStringHashSet& table = data->table();
 
     // Check one last time if the key is present in the table, in case it was
@@ -494,14 +523,15 @@ template DirectHandle<String> StringTable::LookupKey(
 template DirectHandle<String> StringTable::LookupKey(
     LocalIsolate* isolate, StringTableInsertionKey* key);
 
-StringTable::Data* StringTable::EnsureCapacity(PtrComprCageBase cage_base,
+StringTable::Data* StringTable::EnsureCapacity(Shard& shard,
+                                               PtrComprCageBase cage_base,
                                                int additional_elements) {
-  // This call is only allowed while the write mutex is held.
-  write_mutex_.AssertHeld();
+  // This call is only allowed while the shard's write mutex is held.
+  shard.write_mutex.AssertHeld();
 
   // This load can be relaxed as the table pointer can only be modified while
   // the lock is held.
-  Data* data = data_.load(std::memory_order_relaxed);
+  Data* data = shard.data.load(std::memory_order_relaxed);
 
   int new_capacity;
   if (data->table().ShouldResizeToAdd(additional_elements, &new_capacity)) {
@@ -509,11 +539,11 @@ StringTable::Data* StringTable::EnsureCapacity(PtrComprCageBase cage_base,
         Data::Resize(cage_base, std::unique_ptr<Data>(data), new_capacity);
     // `new_data` is the new owner of `data`.
     DCHECK_EQ(new_data->PreviousData(), data);
-    // Release-store the new data pointer as `data_`, so that it can be
-    // acquire-loaded by other threads. This string table becomes the owner of
-    // the pointer.
+    // Release-store the new data pointer as the shard's `data`, so that it
+    // can be acquire-loaded by other threads. This string table becomes the
+    // owner of the pointer.
     data = new_data.release();
-    data_.store(data, std::memory_order_release);
+    shard.data.store(data, std::memory_order_release);
   }
 
   return data;
@@ -603,8 +633,9 @@ Address StringTable::Data::TryStringToIndexOrLookupExisting(
     return Smi::FromInt(ResultSentinel::kUnsupported).ptr();
   }
 
-  Data* string_table_data =
-      isolate->string_table()->data_.load(std::memory_order_acquire);
+  Data* string_table_data = isolate->string_table()
+                                ->ShardFor(key.hash())
+                                .data.load(std::memory_order_acquire);
 
   InternalIndex entry =
       string_table_data->table().FindEntry(isolate, &key, key.hash());
@@ -675,14 +706,31 @@ void StringTable::InsertForIsolateDeserialization(
   DCHECK_EQ(NumberOfElements(), 0);
 
   const int length = static_cast<int>(strings.size());
-  {
-    base::MutexGuard table_write_guard(&write_mutex_);
 
-    Data* const data = EnsureCapacity(isolate, length);
+  // Group the strings by shard, so that each shard is grown at most once.
+  std::vector<uint8_t> shard_indices(length);
+  std::array<int, kShardCount> shard_lengths{};
+  static_assert(kShardCount <= std::numeric_limits<uint8_t>::max());
+  for (int i = 0; i < length; i++) {
+    int shard_index = ShardIndex(strings[i]->EnsureHash());
+    shard_indices[i] = static_cast<uint8_t>(shard_index);
+    shard_lengths[shard_index]++;
+  }
+
+  for (int shard_index = 0; shard_index < kShardCount; shard_index++) {
+    if (shard_lengths[shard_index] == 0) continue;
+    Shard& shard = shards_[shard_index];
+    base::MutexGuard table_write_guard(&shard.write_mutex);
 
-    for (const DirectHandle<String>& s : strings) {
+    Data* const data =
+        EnsureCapacity(shard, isolate, shard_lengths[shard_index]);
+
+    for (int i = 0; i < length; i++) {
+      if (shard_indices[i] != shard_index) continue;
       StringTableInsertionKey key(
-          isolate, s, DeserializingUserCodeOption::kNotDeserializingUserCode);
+          isolate, strings[i],
+          DeserializingUserCodeOption::kNotDeserializingUserCode);
+      DCHECK_EQ(ShardIndex(key.hash()), shard_index);
       InternalIndex entry =
           data->table().FindEntryOrInsertionEntry(isolate, &key, key.hash());
 
@@ -698,14 +746,15 @@ void StringTable::InsertForIsolateDeserialization(
 void StringTable::InsertEmptyStringForBootstrapping(Isolate* isolate) {
   DCHECK_EQ(NumberOfElements(), 0);
   {
-    base::MutexGuard table_write_guard(&write_mutex_);
-
-    Data* const data = EnsureCapacity(isolate, 1);
-
     DirectHandle<String> empty_string =
         ReadOnlyRoots(isolate).empty_string_handle();
     uint32_t hash = empty_string->EnsureHash();
 
+    Shard& shard = ShardFor(hash);
+    base::MutexGuard table_write_guard(&shard.write_mutex);
+
+    Data* const data = EnsureCapacity(shard, isolate, 1);
+
     InternalIndex entry = data->table().FindInsertionEntry(isolate, hash);
 
     DCHECK_IMPLIES(v8_flags.shared_string_table, empty_string->IsShared());
@@ -715,19 +764,32 @@ void StringTable::InsertEmptyStringForBootstrapping(Isolate* isolate) {
 }
 
 void StringTable::Print(PtrComprCageBase cage_base) const {
-  data_.load(std::memory_order_acquire)->Print(cage_base);
+  for (const Shard& shard : shards_) {
+    shard.data.load(std::memory_order_acquire)->Print(cage_base);
+  }
 }
 
 size_t StringTable::GetCurrentMemoryUsage() const {
-  return sizeof(*this) +
-         data_.load(std::memory_order_acquire)->GetCurrentMemoryUsage();
+  size_t usage = sizeof(*this);
+  for (const Shard& shard : shards_) {
+    Data* data = shard.data.load(std::memory_order_acquire);
+    usage += data->GetCurrentMemoryUsage();
+  }
+  return usage;
 }
 
 void StringTable::IterateElements(RootVisitor* visitor) {
+  for (int shard = 0; shard < kShardCount; shard++) {
+    IterateElements(shard, visitor);
+  }
+}
+
+void StringTable::IterateElements(int shard, RootVisitor* visitor) {
   // This should only happen during garbage collection when background threads
   // are paused, so the load can be relaxed.
   isolate_->heap()->safepoint()->AssertActive();
-  data_.load(std::memory_order_relaxed)->IterateElements(visitor);
+  DCHECK_LT(shard, kShardCount);
+  shards_[shard].data.load(std::memory_order_relaxed)->IterateElements(visitor);
 }
 
 void StringTable::DropOldData() {
@@ -735,15 +797,19 @@ void StringTable::DropOldData() {
   // are paused, so the load can be relaxed.
   isolate_->heap()->safepoint()->AssertActive();
   DCHECK_NE(isolate_->heap()->gc_state(), Heap::NOT_IN_GC);
-  data_.load(std::memory_order_relaxed)->DropPreviousData();
+  for (Shard& shard : shards_) {
+    shard.data.load(std::memory_order_relaxed)->DropPreviousData();
+  }
 }
 
-void StringTable::NotifyElementsRemoved(int count) {
+void StringTable::NotifyElementsRemoved(int shard, int count) {
   // This should only happen during garbage collection when background threads
   // are paused, so the load can be relaxed.
   isolate_->heap()->safepoint()->AssertActive();
   DCHECK_NE(isolate_->heap()->gc_state(), Heap::NOT_IN_GC);
-  data_.load(std::memory_order_relaxed)->table().ElementsRemoved(count);
+  DCHECK_LT(shard, kShardCount);
+  shards_[shard].data.load(std::memory_order_relaxed)->table().ElementsRemoved(
+      count);
 }
 
 }  // namespace internal
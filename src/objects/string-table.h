@@ -43,13 +43,22 @@ class SeqOneByteString;
 // StringTable, for internalizing strings. The Lookup methods are designed to be
 // thread-safe, in combination with GC safepoints.
 //
-// The string table layout is defined by its Data implementation class, see
+// Strings are distributed over a fixed number of shards by the upper bits of
+// their hash. Each shard is an independent hash table with its own write lock,
+// so that concurrent insertions (e.g. from background compile threads, or from
+// isolates sharing the string table) only contend when they hit the same
+// shard. Reads don't take any lock.
+//
+// The layout of each shard is defined by its Data implementation class, see
 // StringTable::Data for details.
 class V8_EXPORT_PRIVATE StringTable {
  public:
   static constexpr Tagged<Smi> empty_element() { return Smi::FromInt(0); }
   static constexpr Tagged<Smi> deleted_element() { return Smi::FromInt(1); }
 
+  static constexpr int kShardCountLog2 = 4;
+  static constexpr int kShardCount = 1 << kShardCountLog2;
+
   explicit StringTable(Isolate* isolate);
   ~StringTable();
 
@@ -82,11 +91,12 @@ class V8_EXPORT_PRIVATE StringTable {
   void Print(PtrComprCageBase cage_base) const;
   size_t GetCurrentMemoryUsage() const;
 
-  // The following methods must be called either while holding the write lock,
-  // or while in a Heap safepoint.
+  // The following methods must be called either while holding the write
+  // locks, or while in a Heap safepoint.
   void IterateElements(RootVisitor* visitor);
+  void IterateElements(int shard, RootVisitor* visitor);
   void DropOldData();
-  void NotifyElementsRemoved(int count);
+  void NotifyElementsRemoved(int shard, int count);
 
   void VerifyIfOwnedBy(Isolate* isolate);
 
@@ -94,12 +104,22 @@ class V8_EXPORT_PRIVATE StringTable {
   class OffHeapStringHashSet;
   class Data;
 
-  Data* EnsureCapacity(PtrComprCageBase cage_base, int additional_elements);
+  // Shards are kept on separate cache lines so that writers to different
+  // shards don't interfere.
+  struct alignas(64) Shard {
+    std::atomic<Data*> data;
+    // Write mutex is mutable so that readers of concurrently mutated values
+    // (e.g. NumberOfElements) are allowed to lock it while staying const.
+    mutable base::Mutex write_mutex;
+  };
+
+  static int ShardIndex(uint32_t hash);
+  Shard& ShardFor(uint32_t hash) { return shards_[ShardIndex(hash)]; }
+
+  Data* EnsureCapacity(Shard& shard, PtrComprCageBase cage_base,
+                       int additional_elements);
 
-  std::atomic<Data*> data_;
-  // Write mutex is mutable so that readers of concurrently mutated values (e.g.
-  // NumberOfElements) are allowed to lock it while staying const.
-  mutable base::Mutex write_mutex_;
+  Shard shards_[kShardCount];
   Isolate* isolate_;
 };
 
@@ -4,6 +4,8 @@
 
 #include "src/objects/string.h"
 
+#include <vector>
+
 #include "src/base/small-vector.h"
 #include "src/common/assert-scope.h"
 #include "src/common/globals.h"
@@ -1140,6 +1142,140 @@ bool String::SlowEquals(
   return comparator.Equals(this, other, access_guard);
 }
 
+namespace {
+
+// Long ropes are searched and compared leaf by leaf, since flattening them
+// would copy all of their characters.
+bool ShouldTraverseLeaves(Tagged<String> string) {
+  return IsConsString(string) && !ConsString::cast(string)->IsFlat() &&
+         string->length() >= ConsString::kMinLengthForLeafTraversal;
+}
+
+// Visits the leaves of a string from left to right, starting at the leaf that
+// contains {offset}. ConsStringIterator only keeps the innermost 32 levels of
+// a rope and restarts from the root when it runs out of them, which makes a
+// traversal of the left-deep ropes built by repeated concatenation quadratic.
+// Here the stack grows with the depth of the rope, so a traversal is linear.
+class RopeLeafIterator {
+ public:
+  RopeLeafIterator(Tagged<String> string, int offset) : offset_(offset) {
+    while (IsConsString(string)) {
+      Tagged<ConsString> cons = ConsString::cast(string);
+      Tagged<String> first = cons->first();
+      if (offset_ < first->length()) {
+        stack_.push_back(cons->second());
+        string = first;
+      } else {
+        offset_ -= first->length();
+        string = cons->second();
+      }
+    }
+    next_ = string;
+  }
+  RopeLeafIterator(const RopeLeafIterator&) = delete;
+  RopeLeafIterator& operator=(const RopeLeafIterator&) = delete;
+
+  // Returns the next non-empty leaf, or a null string when done. The offset
+  // within the leaf to start at is only non-zero for the first leaf.
+  Tagged<String> Next(int* offset_out) {
+    while (true) {
+      if (next_.is_null()) {
+        if (stack_.empty()) return {};
+        Tagged<String> string = stack_.back();
+        stack_.pop_back();
+        while (IsConsString(string)) {
+          Tagged<ConsString> cons = ConsString::cast(string);
+          stack_.push_back(cons->second());
+          string = cons->first();
+        }
+        next_ = string;
+      }
+      Tagged<String> leaf = next_;
+      next_ = {};
+      *offset_out = offset_;
+      offset_ = 0;
+      if (leaf->length() > *offset_out) return leaf;
+    }
+  }
+
+ private:
+  // The right halves of the ropes on the path to the current leaf.
+  std::vector<Tagged<String>> stack_;
+  Tagged<String> next_;
+  int offset_;
+};
+
+// The characters of a leaf that haven't been compared yet.
+struct LeafChars {
+  void Reset(Tagged<String> leaf, int offset,
+             const SharedStringAccessGuardIfNeeded& access_guard,
+             const DisallowGarbageCollection& no_gc) {
+    String::FlatContent content = leaf->GetFlatContent(no_gc, access_guard);
+    is_one_byte = content.IsOneByte();
+    if (is_one_byte) {
+      one_byte = content.ToOneByteVector().begin() + offset;
+    } else {
+      two_byte = content.ToUC16Vector().begin() + offset;
+    }
+    length = content.length() - offset;
+  }
+
+  void Advance(int count) {
+    if (is_one_byte) {
+      one_byte += count;
+    } else {
+      two_byte += count;
+    }
+    length -= count;
+  }
+
+  bool is_one_byte = true;
+  const uint8_t* one_byte = nullptr;
+  const base::uc16* two_byte = nullptr;
+  int length = 0;
+};
+
+// Compares the common prefix of {x} and {y} leaf by leaf. Returns a negative
+// value, zero or a positive value if the prefix of {x} orders before, the
+// same as or after the prefix of {y}.
+int CompareLeaves(Tagged<String> x, Tagged<String> y,
+                  const SharedStringAccessGuardIfNeeded& access_guard,
+                  const DisallowGarbageCollection& no_gc) {
+  RopeLeafIterator x_leaves(x, 0);
+  RopeLeafIterator y_leaves(y, 0);
+  LeafChars x_chars;
+  LeafChars y_chars;
+  int offset;
+  while (true) {
+    if (x_chars.length == 0) {
+      Tagged<String> leaf = x_leaves.Next(&offset);
+      if (leaf.is_null()) return 0;
+      x_chars.Reset(leaf, offset, access_guard, no_gc);
+    }
+    if (y_chars.length == 0) {
+      Tagged<String> leaf = y_leaves.Next(&offset);
+      if (leaf.is_null()) return 0;
+      y_chars.Reset(leaf, offset, access_guard, no_gc);
+    }
+    const int to_check = std::min(x_chars.length, y_chars.length);
+    int result;
+    if (x_chars.is_one_byte) {
+      result = y_chars.is_one_byte
+                   ? CompareChars(x_chars.one_byte, y_chars.one_byte, to_check)
+                   : CompareChars(x_chars.one_byte, y_chars.two_byte, to_check);
+    } else {
+      result = y_chars.is_one_byte
+                   ? CompareChars(x_chars.two_byte, y_chars.one_byte, to_check)
+                   : CompareChars(x_chars.two_byte, y_chars.two_byte, to_check);
+    }
+    if (result != 0) return result;
+    x_chars.Advance(to_check);
+    y_chars.Advance(to_check);
+  }
+}
+
+}  // namespace
+
 // static
 bool String::SlowEquals(Isolate* isolate, Handle<String> one,
                         Handle<String> two) {
@@ -1186,6 +1322,21 @@ bool String::SlowEquals(Isolate* isolate, Handle<String> one,
   // before we try to flatten the strings.
   if (one->Get(0) != two->Get(0)) return false;
 
+  if (ShouldTraverseLeaves(*one) || ShouldTraverseLeaves(*two)) {
+    {
+      DisallowGarbageCollection no_gc;
+      if (CompareLeaves(*one, *two, SharedStringAccessGuardIfNeeded(isolate),
+                        no_gc) != 0) {
+        return false;
+      }
+    }
+    // Both strings were traversed to the end, so pay for the copy once
+    // instead of traversing them again on the next comparison.
+    String::Flatten(isolate, one);
+    String::Flatten(isolate, two);
+    return true;
+  }
+
   one = String::Flatten(isolate, one);
   two = String::Flatten(isolate, two);
 
@@ -1229,6 +1380,24 @@ ComparisonResult String::Compare(Isolate* isolate, Handle<String> x,
     return ComparisonResult::kGreaterThan;
   }
 
+  if (ShouldTraverseLeaves(*x) || ShouldTraverseLeaves(*y)) {
+    int r;
+    {
+      DisallowGarbageCollection no_gc;
+      r = CompareLeaves(*x, *y, SharedStringAccessGuardIfNeeded(isolate),
+                        no_gc);
+    }
+    if (r < 0) return ComparisonResult::kLessThan;
+    if (r > 0) return ComparisonResult::kGreaterThan;
+    // The common prefix was traversed to the end, so pay for the copy once
+    // instead of traversing it again on the next comparison.
+    x = String::Flatten(isolate, x);
+    y = String::Flatten(isolate, y);
+    if (x->length() < y->length()) return ComparisonResult::kLessThan;
+    if (x->length() > y->length()) return ComparisonResult::kGreaterThan;
+    return ComparisonResult::kEqual;
+  }
+
   // Slow case.
   x = String::Flatten(isolate, x);
   y = String::Flatten(isolate, y);
@@ -1333,6 +1502,16 @@ int String::IndexOf(Isolate* isolate, Handle<String> receiver,
   uint32_t receiver_length = receiver->length();
   if (start_index + search_length > receiver_length) return -1;
 
+  if (ShouldTraverseLeaves(*receiver)) {
+    search = String::Flatten(isolate, search);
+    int index = IndexOfInRope(isolate, ConsString::cast(*receiver), *search,
+                              start_index);
+    // The rope was searched to the end, so pay for the copy once instead of
+    // traversing it again on the next search.
+    if (index == -1) String::Flatten(isolate, receiver);
+    return index;
+  }
+
   receiver = String::Flatten(isolate, receiver);
   search = String::Flatten(isolate, search);
 
@@ -1352,6 +1531,125 @@ int String::IndexOf(Isolate* isolate, Handle<String> receiver,
                                         start_index);
 }
 
+namespace {
+
+// Searches the leaves of a rope one after the other. A match that spans leaf
+// boundaries is found by searching a window made of the last (pattern length
+// - 1) characters before a leaf followed by the first ones of the leaf.
+template <typename PatternChar>
+class RopeSearch {
+ public:
+  RopeSearch(Isolate* isolate, base::Vector<const PatternChar> pattern)
+      : pattern_length_(pattern.length()),
+        one_byte_search_(isolate, pattern),
+        two_byte_search_(isolate, pattern) {}
+
+  int Search(Tagged<ConsString> rope, int start_index,
+             const DisallowGarbageCollection& no_gc) {
+    RopeLeafIterator iter(rope, start_index);
+    int offset;
+    position_ = start_index;
+    carry_.clear();
+    for (Tagged<String> leaf = iter.Next(&offset); !leaf.is_null();
+         leaf = iter.Next(&offset)) {
+      String::FlatContent content = leaf->GetFlatContent(no_gc);
+      int index;
+      if (content.IsOneByte()) {
+        index = SearchLeaf(content.ToOneByteVector().SubVectorFrom(offset),
+                           &one_byte_search_);
+      } else {
+        index = SearchLeaf(content.ToUC16Vector().SubVectorFrom(offset),
+                           &two_byte_search_);
+      }
+      if (index >= 0) return index;
+    }
+    return -1;
+  }
+
+ private:
+  template <typename SubjectChar>
+  int SearchLeaf(base::Vector<const SubjectChar> chars,
+                 StringSearch<PatternChar, SubjectChar>* search) {
+    const int length = chars.length();
+    const int overlap = pattern_length_ - 1;
+    if (!carry_.empty()) {
+      // Only matches that start in the carry are of interest here, the others
+      // are found when searching the leaf itself.
+      const int carry_length = static_cast<int>(carry_.size());
+      const int head_length = std::min(overlap, length);
+      window_.resize_no_init(carry_length + head_length);
+      std::copy(carry_.begin(), carry_.end(), window_.begin());
+      std::copy(chars.begin(), chars.begin() + head_length,
+                window_.begin() + carry_length);
+      if (static_cast<int>(window_.size()) >= pattern_length_) {
+        int index = two_byte_search_.Search(base::VectorOf(window_), 0);
+        if (index >= 0 && index < carry_length) {
+          return position_ - carry_length + index;
+        }
+      }
+    }
+    if (length >= pattern_length_) {
+      int index = search->Search(chars, 0);
+      if (index >= 0) return position_ + index;
+    }
+    // Keep the last {overlap} characters for the next leaf.
+    if (overlap > 0) {
+      if (length >= overlap) {
+        carry_.resize_no_init(overlap);
+        std::copy(chars.end() - overlap, chars.end(), carry_.begin());
+      } else {
+        const int carry_length = static_cast<int>(carry_.size());
+        const int keep = std::min(carry_length, overlap - length);
+        if (keep < carry_length) {
+          std::copy(carry_.end() - keep, carry_.end(), carry_.begin());
+        }
+        carry_.resize_no_init(keep + length);
+        std::copy(chars.begin(), chars.end(), carry_.begin() + keep);
+      }
+    }
+    position_ += length;
+    return -1;
+  }
+
+  const int pattern_length_;
+  StringSearch<PatternChar, uint8_t> one_byte_search_;
+  StringSearch<PatternChar, base::uc16> two_byte_search_;
+  // Index in the rope of the first character of the next leaf.
+  int position_ = 0;
+  // The characters right before the next leaf.
+  base::SmallVector<base::uc16, 32> carry_;
+  base::SmallVector<base::uc16, 64> window_;
+};
+
+}  // namespace
+
+// static
+int String::IndexOfInRope(Isolate* isolate, Tagged<ConsString> receiver,
+                          Tagged<String> search, int start_index) {
+  DCHECK_LE(0, start_index);
+  DCHECK_LE(start_index + search->length(), receiver->length());
+  DCHECK_LT(0, search->length());
+  DisallowGarbageCollection no_gc;
+  String::FlatContent search_content = search->GetFlatContent(no_gc);
+  if (search_content.IsOneByte()) {
+    RopeSearch<uint8_t> rope_search(isolate,
+                                    search_content.ToOneByteVector());
+    return rope_search.Search(receiver, start_index, no_gc);
+  }
+  RopeSearch<base::uc16> rope_search(isolate, search_content.ToUC16Vector());
+  return rope_search.Search(receiver, start_index, no_gc);
+}
+
+// static
+intptr_t String::IndexOfInRopeRaw(Isolate* isolate, Address raw_receiver,
+                                  Address raw_search, intptr_t start_index) {
+  Tagged<ConsString> receiver =
+      ConsString::cast(Tagged<Object>(raw_receiver));
+  Tagged<String> search = String::cast(Tagged<Object>(raw_search));
+  return IndexOfInRope(isolate, receiver, search,
+                       static_cast<int>(start_index));
+}
+
 MaybeHandle<String> String::GetSubstitution(Isolate* isolate, Match* match,
                                             Handle<String> replacement,
                                             int start_index) {
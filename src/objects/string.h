@@ -334,6 +334,14 @@ V8_OBJECT class String : public Name {
   // check any arguments.
   static int IndexOf(Isolate* isolate, Handle<String> receiver,
                      Handle<String> search, int start_index);
+  // Like IndexOf, but searches the leaves of a rope one after the other
+  // instead of flattening it. {search} must be flat.
+  static int IndexOfInRope(Isolate* isolate, Tagged<ConsString> receiver,
+                           Tagged<String> search, int start_index);
+  // Called from the StringIndexOf builtin. {raw_receiver} is a tagged
+  // ConsString pointer and {raw_search} a tagged flat String pointer.
+  static intptr_t IndexOfInRopeRaw(Isolate* isolate, Address raw_receiver,
+                                   Address raw_search, intptr_t start_index);
 
   static Tagged<Object> LastIndexOf(Isolate* isolate, Handle<Object> receiver,
                                     Handle<Object> search,
@@ -947,6 +955,10 @@ V8_OBJECT class ConsString : public String {
   // Minimum length for a cons string.
   static const int kMinLength = 13;
 
+  // Unflattened cons strings at least this long are searched and compared
+  // leaf by leaf instead of being flattened, which would copy them.
+  static const int kMinLengthForLeafTraversal = 1024;
+
   DECL_CAST(ConsString)
   DECL_VERIFIER(ConsString)
 
@@ -710,7 +710,7 @@ void Utf8ExternalStreamingStream::FillBufferFromCurrentChunk() {
     size_t max_buffer = max_buffer_end - output_cursor;
     int max_length = static_cast<int>(std::min(remaining, max_buffer));
     DCHECK_EQ(state, unibrow::Utf8::State::kAccept);
-    int ascii_length = NonAsciiStart(cursor, max_length);
+    int ascii_length = AsciiPrefixLength(cursor, max_length);
     CopyChars(output_cursor, cursor, ascii_length);
     cursor += ascii_length;
     output_cursor += ascii_length;
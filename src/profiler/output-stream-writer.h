@@ -61,6 +61,10 @@ class OutputStreamWriter {
   void AddSubstring(const char* s, int n) {
     if (n <= 0) return;
     DCHECK_LE(n, strlen(s));
+    AddBytes(s, n);
+  }
+  // Like AddSubstring, but |s| may contain NUL characters.
+  void AddBytes(const char* s, int n) {
     const char* s_end = s + n;
     while (s < s_end) {
       int s_chunk_size =
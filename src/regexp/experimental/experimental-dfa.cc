@@ -0,0 +1,202 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/experimental/experimental-dfa.h"
+
+#include <algorithm>
+
+namespace v8 {
+namespace internal {
+
+// static
+bool ExperimentalRegExpDfa::CanBeHandled(
+    base::Vector<const RegExpInstruction> bytecode) {
+  for (const RegExpInstruction& inst : bytecode) {
+    switch (inst.opcode) {
+      case RegExpInstruction::ACCEPT:
+      case RegExpInstruction::CLEAR_REGISTER:
+      case RegExpInstruction::CONSUME_RANGE:
+      case RegExpInstruction::FORK:
+      case RegExpInstruction::JMP:
+      case RegExpInstruction::SET_REGISTER_TO_CP:
+      case RegExpInstruction::BEGIN_LOOP:
+      case RegExpInstruction::END_LOOP:
+        break;
+      case RegExpInstruction::ASSERTION:
+      case RegExpInstruction::WRITE_LOOKBEHIND_TABLE:
+      case RegExpInstruction::READ_LOOKBEHIND_TABLE:
+        return false;
+    }
+  }
+  return true;
+}
+
+ExperimentalRegExpDfa::ExperimentalRegExpDfa(
+    base::Vector<const RegExpInstruction> bytecode)
+    : bytecode_(bytecode.begin(), bytecode.end()) {
+  DCHECK(CanBeHandled(bytecode));
+  DCHECK(!bytecode_.empty());
+
+  class_starts_.push_back(0);
+  for (const RegExpInstruction& inst : bytecode_) {
+    if (inst.opcode != RegExpInstruction::CONSUME_RANGE) continue;
+    const RegExpInstruction::Uc16Range& range = inst.payload.consume_range;
+    if (range.min > range.max) continue;
+    class_starts_.push_back(range.min);
+    if (range.max < 0xFFFF) class_starts_.push_back(range.max + 1);
+  }
+  std::sort(class_starts_.begin(), class_starts_.end());
+  class_starts_.erase(std::unique(class_starts_.begin(), class_starts_.end()),
+                      class_starts_.end());
+  class_count_ = static_cast<int>(class_starts_.size());
+
+  for (int c = 0; c < kLatin1Size; ++c) {
+    auto it = std::upper_bound(class_starts_.begin(), class_starts_.end(), c);
+    latin1_classes_[c] = static_cast<uint16_t>(it - class_starts_.begin() - 1);
+  }
+
+  // The dead and the accept state have no program counters.  Their
+  // transitions are never taken.
+  states_.resize(2);
+  transitions_.resize(2 * class_count_, kUnknownState);
+
+  std::vector<int> pcs;
+  std::vector<bool> visited(bytecode_.size());
+  if (AddClosure(0, &pcs, &visited)) {
+    start_state_ = kAcceptState;
+  } else if (pcs.empty()) {
+    start_state_ = kDeadState;
+  } else {
+    std::sort(pcs.begin(), pcs.end());
+    start_state_ = AddState(std::move(pcs));
+    if (start_state_ == kUnknownState) out_of_memory_ = true;
+  }
+}
+
+template <class Character>
+ExperimentalRegExpDfa::Result ExperimentalRegExpDfa::Scan(
+    base::Vector<const Character> input, int start_index) {
+  DCHECK_GE(start_index, 0);
+  DCHECK_LE(start_index, input.length());
+  if (out_of_memory_) return Result::kUnknown;
+
+  int state = start_state_;
+  for (int i = start_index; i < input.length(); ++i) {
+    if (state <= kAcceptState) break;
+    const int character_class = CharacterClass(input[i]);
+    int next = transitions_[state * class_count_ + character_class];
+    if (V8_UNLIKELY(next == kUnknownState)) {
+      next = ComputeTransition(state, character_class);
+      if (next == kUnknownState) return Result::kUnknown;
+    }
+    state = next;
+  }
+  return state == kAcceptState ? Result::kMatch : Result::kNoMatch;
+}
+
+template ExperimentalRegExpDfa::Result ExperimentalRegExpDfa::Scan(
+    base::Vector<const uint8_t> input, int start_index);
+template ExperimentalRegExpDfa::Result ExperimentalRegExpDfa::Scan(
+    base::Vector<const base::uc16> input, int start_index);
+
+int ExperimentalRegExpDfa::CharacterClass(base::uc16 c) const {
+  if (c < kLatin1Size) return latin1_classes_[c];
+  auto it = std::upper_bound(class_starts_.begin(), class_starts_.end(), c);
+  return static_cast<int>(it - class_starts_.begin() - 1);
+}
+
+int ExperimentalRegExpDfa::AddState(std::vector<int> pcs) {
+  DCHECK(std::is_sorted(pcs.begin(), pcs.end()));
+  auto it = state_ids_.find(pcs);
+  if (it != state_ids_.end()) return it->second;
+
+  if (transitions_.size() + class_count_ > kMaxTransitions) {
+    return kUnknownState;
+  }
+  const int state = static_cast<int>(states_.size());
+  transitions_.resize(transitions_.size() + class_count_, kUnknownState);
+  state_ids_.emplace(pcs, state);
+  states_.push_back(std::move(pcs));
+  return state;
+}
+
+int ExperimentalRegExpDfa::ComputeTransition(int state, int character_class) {
+  DCHECK_GT(state, kAcceptState);
+  const base::uc16 c = class_starts_[character_class];
+
+  std::vector<int> next_pcs;
+  std::vector<bool> visited(bytecode_.size());
+  bool accepting = false;
+  for (int pc : states_[state]) {
+    const RegExpInstruction::Uc16Range& range =
+        bytecode_[pc].payload.consume_range;
+    if (range.min <= c && c <= range.max &&
+        AddClosure(pc + 1, &next_pcs, &visited)) {
+      accepting = true;
+      break;
+    }
+  }
+
+  int next;
+  if (accepting) {
+    next = kAcceptState;
+  } else if (next_pcs.empty()) {
+    next = kDeadState;
+  } else {
+    std::sort(next_pcs.begin(), next_pcs.end());
+    next = AddState(std::move(next_pcs));
+    if (next == kUnknownState) {
+      out_of_memory_ = true;
+      return kUnknownState;
+    }
+  }
+  transitions_[state * class_count_ + character_class] = next;
+  return next;
+}
+
+bool ExperimentalRegExpDfa::AddClosure(int pc, std::vector<int>* pcs,
+                                       std::vector<bool>* visited) {
+  bool accepting = false;
+  std::vector<int> worklist = {pc};
+  while (!worklist.empty()) {
+    const int current = worklist.back();
+    worklist.pop_back();
+    if ((*visited)[current]) continue;
+    (*visited)[current] = true;
+
+    const RegExpInstruction& inst = bytecode_[current];
+    switch (inst.opcode) {
+      case RegExpInstruction::CONSUME_RANGE:
+        // Skip empty ranges, which are used to encode failure.
+        if (inst.payload.consume_range.min <= inst.payload.consume_range.max) {
+          pcs->push_back(current);
+        }
+        break;
+      case RegExpInstruction::ACCEPT:
+        accepting = true;
+        break;
+      case RegExpInstruction::FORK:
+        worklist.push_back(inst.payload.pc);
+        worklist.push_back(current + 1);
+        break;
+      case RegExpInstruction::JMP:
+        worklist.push_back(inst.payload.pc);
+        break;
+      case RegExpInstruction::SET_REGISTER_TO_CP:
+      case RegExpInstruction::CLEAR_REGISTER:
+      case RegExpInstruction::BEGIN_LOOP:
+      case RegExpInstruction::END_LOOP:
+        worklist.push_back(current + 1);
+        break;
+      case RegExpInstruction::ASSERTION:
+      case RegExpInstruction::WRITE_LOOKBEHIND_TABLE:
+      case RegExpInstruction::READ_LOOKBEHIND_TABLE:
+        UNREACHABLE();
+    }
+  }
+  return accepting;
+}
+
+}  // namespace internal
+}  // namespace v8
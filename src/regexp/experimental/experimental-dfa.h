@@ -0,0 +1,94 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_DFA_H_
+#define V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_DFA_H_
+
+#include <array>
+#include <map>
+#include <vector>
+
+#include "include/v8-internal.h"
+#include "src/base/vector.h"
+#include "src/regexp/experimental/experimental-bytecode.h"
+
+namespace v8 {
+namespace internal {
+
+// A lazily constructed deterministic automaton for an EXPERIMENTAL bytecode
+// program.  Each DFA state is the set of program counters at which some NFA
+// thread waits for the next character, so a DFA state can be stepped with one
+// table lookup per input character instead of running every NFA thread.
+// States and transitions are only created when the input first requires them.
+//
+// The DFA ignores registers and thread priorities and can therefore only
+// answer whether the program matches at all, not where.  The NFA interpreter
+// uses it to skip searches that are bound to fail, which is the common case
+// when scanning large inputs.  Since BEGIN_LOOP and END_LOOP only prune
+// empty quantifier iterations, which never make additional input positions
+// reachable, the DFA treats them as no-ops.  Programs containing assertions
+// or lookbehinds are not supported.
+class ExperimentalRegExpDfa final {
+ public:
+  // Kept in the regexp's data array in a Managed.
+  static constexpr ExternalPointerTag kManagedTag = kExperimentalRegExpDfaTag;
+
+  enum class Result { kMatch, kNoMatch, kUnknown };
+
+  // Returns whether `bytecode` only uses instructions supported by the DFA.
+  static bool CanBeHandled(base::Vector<const RegExpInstruction> bytecode);
+
+  explicit ExperimentalRegExpDfa(
+      base::Vector<const RegExpInstruction> bytecode);
+  ExperimentalRegExpDfa(const ExperimentalRegExpDfa&) = delete;
+  ExperimentalRegExpDfa& operator=(const ExperimentalRegExpDfa&) = delete;
+
+  // Returns whether the program has a match starting at or after
+  // `start_index`, or kUnknown if the DFA ran out of memory.  Runs in time
+  // linear in the length of the input.
+  template <class Character>
+  Result Scan(base::Vector<const Character> input, int start_index);
+
+ private:
+  static constexpr int kUnknownState = -1;
+  // No thread is left.
+  static constexpr int kDeadState = 0;
+  // Some thread has reached ACCEPT.  All accepting states are merged into one
+  // since scanning stops there.
+  static constexpr int kAcceptState = 1;
+  // Upper bound on the number of transition table entries.
+  static constexpr size_t kMaxTransitions = 256 * 1024;
+  static constexpr int kLatin1Size = 256;
+
+  int CharacterClass(base::uc16 c) const;
+  // Returns the id of the state for the given sorted set of program counters,
+  // creating it if necessary, or kUnknownState if the memory budget is
+  // exhausted.
+  int AddState(std::vector<int> pcs);
+  int ComputeTransition(int state, int character_class);
+  // Adds the program counters reachable from `pc` without consuming input.
+  // Returns true if an ACCEPT instruction is reachable.
+  bool AddClosure(int pc, std::vector<int>* pcs, std::vector<bool>* visited);
+
+  std::vector<RegExpInstruction> bytecode_;
+
+  // Input characters are partitioned into classes such that every
+  // CONSUME_RANGE instruction accepts either all or no characters of a class.
+  // `class_starts_` holds the smallest character of each class.
+  std::vector<base::uc16> class_starts_;
+  std::array<uint16_t, kLatin1Size> latin1_classes_;
+  int class_count_;
+
+  std::vector<std::vector<int>> states_;
+  std::map<std::vector<int>, int> state_ids_;
+  // Indexed by state * class_count_ + character class.
+  std::vector<int> transitions_;
+  int start_state_;
+  bool out_of_memory_ = false;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_DFA_H_
@@ -9,6 +9,7 @@
 #include "src/common/assert-scope.h"
 #include "src/objects/fixed-array-inl.h"
 #include "src/objects/string-inl.h"
+#include "src/regexp/experimental/experimental-dfa.h"
 #include "src/regexp/experimental/experimental.h"
 #include "src/strings/char-predicates-inl.h"
 #include "src/zone/zone-allocator.h"
@@ -138,7 +139,8 @@ class NfaInterpreter {
  public:
   NfaInterpreter(Isolate* isolate, RegExp::CallOrigin call_origin,
                  Tagged<ByteArray> bytecode, int register_count_per_match,
-                 Tagged<String> input, int32_t input_index, Zone* zone)
+                 Tagged<String> input, int32_t input_index,
+                 ExperimentalRegExpDfa* dfa, Zone* zone)
       : isolate_(isolate),
         call_origin_(call_origin),
         bytecode_object_(bytecode),
@@ -156,6 +158,7 @@ class NfaInterpreter {
         best_match_registers_(base::nullopt),
         lookbehind_pc_(0, zone),
         lookbehind_table_(0, zone),
+        dfa_(dfa),
         zone_(zone) {
     DCHECK(!bytecode_.empty());
     DCHECK_GE(input_index_, 0);
@@ -189,6 +192,13 @@ class NfaInterpreter {
 
     int match_num = 0;
     while (match_num != max_match_num) {
+      // The DFA tells in a single cheap pass whether there is a match at all,
+      // which saves running the NFA over the rest of the input if not.
+      if (dfa_ != nullptr && dfa_->Scan(input_, input_index_) ==
+                                 ExperimentalRegExpDfa::Result::kNoMatch) {
+        break;
+      }
+
       int err_code = FindNextMatch();
       if (err_code != RegExp::kInternalRegExpSuccess) return err_code;
 
@@ -698,6 +708,9 @@ class NfaInterpreter {
   // lookbehind of index k did complete a match on the current position.
   ZoneList<bool> lookbehind_table_;
 
+  // Optional DFA for the bytecode, used to rule out matches quickly.
+  ExperimentalRegExpDfa* dfa_;
+
   Zone* zone_;
 };
 
@@ -707,20 +720,20 @@ int ExperimentalRegExpInterpreter::FindMatches(
     Isolate* isolate, RegExp::CallOrigin call_origin,
     Tagged<ByteArray> bytecode, int register_count_per_match,
     Tagged<String> input, int start_index, int32_t* output_registers,
-    int output_register_count, Zone* zone) {
+    int output_register_count, ExperimentalRegExpDfa* dfa, Zone* zone) {
   DCHECK(input->IsFlat());
   DisallowGarbageCollection no_gc;
 
   if (input->GetFlatContent(no_gc).IsOneByte()) {
     NfaInterpreter<uint8_t> interpreter(isolate, call_origin, bytecode,
                                         register_count_per_match, input,
-                                        start_index, zone);
+                                        start_index, dfa, zone);
     return interpreter.FindMatches(output_registers, output_register_count);
   } else {
     DCHECK(input->GetFlatContent(no_gc).IsTwoByte());
     NfaInterpreter<base::uc16> interpreter(isolate, call_origin, bytecode,
                                            register_count_per_match, input,
-                                           start_index, zone);
+                                           start_index, dfa, zone);
     return interpreter.FindMatches(output_registers, output_register_count);
   }
 }
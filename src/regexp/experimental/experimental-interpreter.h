@@ -12,6 +12,7 @@ namespace v8 {
 namespace internal {
 
 class ByteArray;
+class ExperimentalRegExpDfa;
 class String;
 class Zone;
 
@@ -22,12 +23,13 @@ class ExperimentalRegExpInterpreter final : public AllStatic {
   // `max_match_num` matches in `input`, starting at `start_index`.  Returns
   // the actual number of matches found.  The boundaries of matching subranges
   // are written to `matches_out`.  Provided in variants for one-byte and
-  // two-byte strings.
+  // two-byte strings.  If `dfa` is not null, it is used to skip searches that
+  // cannot succeed.
   static int FindMatches(Isolate* isolate, RegExp::CallOrigin call_origin,
                          Tagged<ByteArray> bytecode, int capture_count,
                          Tagged<String> input, int start_index,
                          int32_t* output_registers, int output_register_count,
-                         Zone* zone);
+                         ExperimentalRegExpDfa* dfa, Zone* zone);
 };
 
 }  // namespace internal
@@ -6,7 +6,9 @@
 
 #include "src/common/assert-scope.h"
 #include "src/objects/js-regexp-inl.h"
+#include "src/objects/managed-inl.h"
 #include "src/regexp/experimental/experimental-compiler.h"
+#include "src/regexp/experimental/experimental-dfa.h"
 #include "src/regexp/experimental/experimental-interpreter.h"
 #include "src/regexp/regexp-parser.h"
 #include "src/utils/ostreams.h"
@@ -27,6 +29,13 @@ bool ExperimentalRegExp::CanBeHandled(RegExpTree* tree, Handle<String> pattern,
   return can_be_handled;
 }
 
+bool ExperimentalRegExp::CanBeHandledByDfa(RegExpTree* tree,
+                                           RegExpFlags flags, Zone* zone) {
+  ZoneList<RegExpInstruction> bytecode =
+      ExperimentalRegExpCompiler::Compile(tree, flags, zone);
+  return ExperimentalRegExpDfa::CanBeHandled(bytecode.ToVector());
+}
+
 void ExperimentalRegExp::Initialize(Isolate* isolate, Handle<JSRegExp> re,
                                     Handle<String> source, RegExpFlags flags,
                                     int capture_count) {
@@ -104,6 +113,15 @@ base::Optional<CompilationResult> CompileImpl(Isolate* isolate,
 
 }  // namespace
 
+base::Vector<RegExpInstruction> AsInstructionSequence(
+    Tagged<ByteArray> raw_bytes) {
+  RegExpInstruction* inst_begin =
+      reinterpret_cast<RegExpInstruction*>(raw_bytes->begin());
+  int inst_num = raw_bytes->length() / sizeof(RegExpInstruction);
+  DCHECK_EQ(sizeof(RegExpInstruction) * inst_num, raw_bytes->length());
+  return base::Vector<RegExpInstruction>(inst_begin, inst_num);
+}
+
 bool ExperimentalRegExp::Compile(Isolate* isolate, Handle<JSRegExp> re) {
   DCHECK(v8_flags.enable_experimental_regexp_engine);
   DCHECK_EQ(re->type_tag(), JSRegExp::EXPERIMENTAL);
@@ -126,16 +144,28 @@ bool ExperimentalRegExp::Compile(Isolate* isolate, Handle<JSRegExp> re) {
   re->set_bytecode_and_trampoline(isolate, compilation_result->bytecode);
   re->set_capture_name_map(compilation_result->capture_name_map);
 
-  return true;
-}
+  // The DFA lives as long as the data array, so the states it builds are
+  // shared by all executions of the regexp and by regexps with the same
+  // source and flags through the compilation cache.
+  if (v8_flags.regexp_lazy_dfa) {
+    std::unique_ptr<ExperimentalRegExpDfa> dfa;
+    size_t estimated_size = sizeof(ExperimentalRegExpDfa);
+    {
+      DisallowGarbageCollection no_gc;
+      base::Vector<const RegExpInstruction> bytecode =
+          AsInstructionSequence(*compilation_result->bytecode);
+      if (ExperimentalRegExpDfa::CanBeHandled(bytecode)) {
+        dfa = std::make_unique<ExperimentalRegExpDfa>(bytecode);
+        estimated_size += bytecode.length() * sizeof(RegExpInstruction);
+      }
+    }
+    if (dfa) {
+      re->set_experimental_dfa(*Managed<ExperimentalRegExpDfa>::FromUniquePtr(
+          isolate, estimated_size, std::move(dfa)));
+    }
+  }
 
-base::Vector<RegExpInstruction> AsInstructionSequence(
-    Tagged<ByteArray> raw_bytes) {
-  RegExpInstruction* inst_begin =
-      reinterpret_cast<RegExpInstruction*>(raw_bytes->begin());
-  int inst_num = raw_bytes->length() / sizeof(RegExpInstruction);
-  DCHECK_EQ(sizeof(RegExpInstruction) * inst_num, raw_bytes->length());
-  return base::Vector<RegExpInstruction>(inst_begin, inst_num);
+  return true;
 }
 
 namespace {
@@ -143,7 +173,8 @@ namespace {
 int32_t ExecRawImpl(Isolate* isolate, RegExp::CallOrigin call_origin,
                     Tagged<ByteArray> bytecode, Tagged<String> subject,
                     int capture_count, int32_t* output_registers,
-                    int32_t output_register_count, int32_t subject_index) {
+                    int32_t output_register_count, int32_t subject_index,
+                    ExperimentalRegExpDfa* dfa) {
   DisallowGarbageCollection no_gc;
   // TODO(cbruni): remove once gcmole is fixed.
   DisableGCMole no_gc_mole;
@@ -156,7 +187,7 @@ int32_t ExecRawImpl(Isolate* isolate, RegExp::CallOrigin call_origin,
   Zone zone(isolate->allocator(), ZONE_NAME);
   result = ExperimentalRegExpInterpreter::FindMatches(
       isolate, call_origin, bytecode, register_count_per_match, subject,
-      subject_index, output_registers, output_register_count, &zone);
+      subject_index, output_registers, output_register_count, dfa, &zone);
   return result;
 }
 
@@ -178,9 +209,17 @@ int32_t ExperimentalRegExp::ExecRaw(
   static constexpr bool kIsLatin1 = true;
   Tagged<ByteArray> bytecode = ByteArray::cast(regexp->bytecode(kIsLatin1));
 
+  // Holds a reference so that the DFA survives the data array being dropped
+  // by code that runs while the interpreter handles interrupts.
+  std::shared_ptr<ExperimentalRegExpDfa> dfa;
+  Tagged<Object> dfa_object = regexp->experimental_dfa();
+  if (IsForeign(dfa_object)) {
+    dfa = Managed<ExperimentalRegExpDfa>::cast(dfa_object)->get();
+  }
+
   return ExecRawImpl(isolate, call_origin, bytecode, subject,
                      regexp->capture_count(), output_registers,
-                     output_register_count, subject_index);
+                     output_register_count, subject_index, dfa.get());
 }
 
 int32_t ExperimentalRegExp::MatchForCallFromJs(
@@ -286,7 +325,7 @@ int32_t ExperimentalRegExp::OneshotExecRaw(Isolate* isolate,
   return ExecRawImpl(isolate, RegExp::kFromRuntime,
                      *compilation_result->bytecode, *subject,
                      regexp->capture_count(), output_registers,
-                     output_register_count, subject_index);
+                     output_register_count, subject_index, nullptr);
 }
 
 MaybeHandle<Object> ExperimentalRegExp::OneshotExec(
@@ -22,6 +22,11 @@ class ExperimentalRegExp final : public AllStatic {
   // AST again is more flexible and less error prone (but less performant).
   static bool CanBeHandled(RegExpTree* tree, Handle<String> pattern,
                            RegExpFlags flags, int capture_count);
+  // Check whether the lazy DFA supports the bytecode a pattern accepted by
+  // `CanBeHandled` compiles to, i.e. whether it has neither assertions nor
+  // lookbehinds.
+  static bool CanBeHandledByDfa(RegExpTree* tree, RegExpFlags flags,
+                                Zone* zone);
   static void Initialize(Isolate* isolate, Handle<JSRegExp> re,
                          Handle<String> pattern, RegExpFlags flags,
                          int capture_count);
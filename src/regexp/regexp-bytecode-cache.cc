@@ -0,0 +1,89 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/regexp-bytecode-cache.h"
+
+#include "src/base/functional.h"
+#include "src/base/lazy-instance.h"
+
+namespace v8 {
+namespace internal {
+
+bool RegExpBytecodeCache::Key::operator==(const Key& other) const {
+  return source == other.source && flags == other.flags &&
+         is_one_byte == other.is_one_byte &&
+         backtrack_limit == other.backtrack_limit &&
+         flag_hash == other.flag_hash;
+}
+
+// static
+size_t RegExpBytecodeCache::Hash(const Key& key) {
+  base::Hasher hasher;
+  hasher.AddRange(key.source.begin(), key.source.end());
+  hasher.Add(static_cast<int>(key.flags));
+  hasher.Add(key.is_one_byte);
+  hasher.Add(key.backtrack_limit);
+  hasher.Add(key.flag_hash);
+  return hasher.hash();
+}
+
+// static
+size_t RegExpBytecodeCache::SizeOf(const Key& key, const Entry& entry) {
+  size_t size = key.source.size() * sizeof(base::uc16) + entry.bytecode.size();
+  for (const auto& [name, index] : entry.named_captures) {
+    size += name.size() * sizeof(base::uc16);
+  }
+  return size;
+}
+
+std::shared_ptr<const RegExpBytecodeCache::Entry> RegExpBytecodeCache::Lookup(
+    const Key& key) {
+  base::MutexGuard guard(&mutex_);
+  auto [begin, end] = index_.equal_range(Hash(key));
+  for (auto it = begin; it != end; ++it) {
+    EntryList::iterator entry = it->second;
+    if (entry->first == key) {
+      entries_.splice(entries_.begin(), entries_, entry);
+      return entry->second;
+    }
+  }
+  return nullptr;
+}
+
+void RegExpBytecodeCache::Insert(Key key, std::shared_ptr<const Entry> entry) {
+  const size_t hash = Hash(key);
+  const size_t size = SizeOf(key, *entry);
+  if (size > kMaxSizeInBytes) return;
+
+  base::MutexGuard guard(&mutex_);
+  auto [begin, end] = index_.equal_range(hash);
+  for (auto it = begin; it != end; ++it) {
+    // Another isolate compiled the same pattern concurrently.
+    if (it->second->first == key) return;
+  }
+  while (size_in_bytes_ + size > kMaxSizeInBytes) {
+    Evict(std::prev(entries_.end()));
+  }
+  entries_.emplace_front(std::move(key), std::move(entry));
+  index_.emplace(hash, entries_.begin());
+  size_in_bytes_ += size;
+}
+
+void RegExpBytecodeCache::Evict(EntryList::iterator entry) {
+  auto [begin, end] = index_.equal_range(Hash(entry->first));
+  for (auto it = begin; it != end; ++it) {
+    if (it->second == entry) {
+      index_.erase(it);
+      break;
+    }
+  }
+  size_in_bytes_ -= SizeOf(entry->first, *entry->second);
+  entries_.erase(entry);
+}
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(RegExpBytecodeCache,
+                                GetProcessWideRegExpBytecodeCache)
+
+}  // namespace internal
+}  // namespace v8
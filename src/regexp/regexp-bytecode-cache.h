@@ -0,0 +1,80 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_REGEXP_BYTECODE_CACHE_H_
+#define V8_REGEXP_REGEXP_BYTECODE_CACHE_H_
+
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "src/base/platform/mutex.h"
+#include "src/base/strings.h"
+#include "src/common/globals.h"
+#include "src/regexp/regexp-flags.h"
+
+namespace v8 {
+namespace internal {
+
+// A process-wide cache of irregexp bytecode. Bytecode neither references the
+// heap nor the isolate, so once a pattern has been compiled in one isolate,
+// other isolates running the same code (e.g. workers) copy the bytecode
+// instead of parsing and compiling the pattern again. Native code is not
+// shared since it embeds isolate-specific addresses and heap objects.
+class RegExpBytecodeCache final {
+ public:
+  struct Key {
+    std::vector<base::uc16> source;
+    RegExpFlags flags;
+    bool is_one_byte;
+    uint32_t backtrack_limit;
+    // Hash of all V8 flags, several of which affect the generated bytecode.
+    uint32_t flag_hash;
+
+    bool operator==(const Key& other) const;
+  };
+
+  struct Entry {
+    std::vector<uint8_t> bytecode;
+    int register_count;
+    // The backtrack limit as adjusted by the compiler.
+    uint32_t backtrack_limit;
+    // Names of named capture groups along with their indices, sorted by index.
+    std::vector<std::pair<std::vector<base::uc16>, int>> named_captures;
+  };
+
+  RegExpBytecodeCache() = default;
+  RegExpBytecodeCache(const RegExpBytecodeCache&) = delete;
+  RegExpBytecodeCache& operator=(const RegExpBytecodeCache&) = delete;
+
+  // Returns the cached entry for `key`, or nullptr.
+  std::shared_ptr<const Entry> Lookup(const Key& key);
+  void Insert(Key key, std::shared_ptr<const Entry> entry);
+
+ private:
+  // Least recently used entries are evicted beyond this size.
+  static constexpr size_t kMaxSizeInBytes = 4 * MB;
+
+  using EntryList = std::list<std::pair<Key, std::shared_ptr<const Entry>>>;
+
+  static size_t Hash(const Key& key);
+  static size_t SizeOf(const Key& key, const Entry& entry);
+
+  void Evict(EntryList::iterator entry);
+
+  base::Mutex mutex_;
+  // Most recently used entries first.
+  EntryList entries_;
+  std::unordered_multimap<size_t, EntryList::iterator> index_;
+  size_t size_in_bytes_ = 0;
+};
+
+V8_EXPORT_PRIVATE RegExpBytecodeCache* GetProcessWideRegExpBytecodeCache();
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_REGEXP_BYTECODE_CACHE_H_
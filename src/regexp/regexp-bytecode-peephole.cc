@@ -614,6 +614,37 @@ void RegExpBytecodePeephole::DefineStandardSequences() {
       .IgnoreArgument(2, 4, 4)   // indirect loop jump
       .IgnoreArgument(3, 4, 4)   // jump out of loop
       .IgnoreArgument(4, 4, 4);  // loop jump
+
+  // The sequences below are not loops, but the most common pairs when
+  // matching literal text. Fusing them saves one dispatch per comparison.
+  CreateSequence(BC_LOAD_CURRENT_CHAR)
+      .FollowedBy(BC_CHECK_NOT_CHAR)
+      .ReplaceWith(BC_CHECK_NOT_CHAR_AT)
+      .MapArgument(0, 1, 3)     // load offset
+      .MapArgument(1, 1, 3, 4)  // character
+      .MapArgument(1, 4, 4)     // goto when not equal
+      .MapArgument(0, 4, 4);    // goto when out of range
+
+  CreateSequence(BC_LOAD_CURRENT_CHAR_UNCHECKED)
+      .FollowedBy(BC_CHECK_NOT_CHAR)
+      .ReplaceWith(BC_CHECK_NOT_CHAR_AT_UNCHECKED)
+      .MapArgument(0, 1, 3)     // load offset
+      .MapArgument(1, 1, 3, 4)  // character
+      .MapArgument(1, 4, 4);    // goto when not equal
+
+  CreateSequence(BC_LOAD_2_CURRENT_CHARS_UNCHECKED)
+      .FollowedBy(BC_CHECK_NOT_CHAR)
+      .ReplaceWith(BC_CHECK_NOT_2_CHARS_AT_UNCHECKED)
+      .MapArgument(0, 1, 3)     // load offset
+      .MapArgument(1, 1, 3, 4)  // characters
+      .MapArgument(1, 4, 4);    // goto when not equal
+
+  CreateSequence(BC_LOAD_4_CURRENT_CHARS_UNCHECKED)
+      .FollowedBy(BC_CHECK_NOT_4_CHARS)
+      .ReplaceWith(BC_CHECK_NOT_4_CHARS_AT_UNCHECKED)
+      .MapArgument(0, 1, 3)   // load offset
+      .MapArgument(1, 4, 4)   // characters
+      .MapArgument(1, 8, 4);  // goto when not equal
 }
 
 bool RegExpBytecodePeephole::OptimizeBytecode(const uint8_t* bytecode,
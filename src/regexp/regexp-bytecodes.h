@@ -211,7 +211,44 @@ static_assert(1 << BYTECODE_SHIFT > BYTECODE_MASK);
   /* 0x40 - 0xBF    Bit Table                                               */ \
   /* 0xC0 - 0xDF    Address of bytecode when character is matched           */ \
   /* 0xE0 - 0xFF    Address of bytecode when no match                       */ \
-  V(SKIP_UNTIL_GT_OR_NOT_BIT_IN_TABLE, 58, 32)
+  V(SKIP_UNTIL_GT_OR_NOT_BIT_IN_TABLE, 58, 32)                                 \
+  /* Combination of:                                                        */ \
+  /* LOAD_CURRENT_CHAR and CHECK_NOT_CHAR                                   */ \
+  /* Emitted by RegExpBytecodePeepholeOptimization.                         */ \
+  /* Bit Layout:                                                            */ \
+  /* 0x00 - 0x07    0x3B (fixed) Bytecode                                   */ \
+  /* 0x08 - 0x1F    Load character offset from current position             */ \
+  /* 0x20 - 0x3F    Character to check                                      */ \
+  /* 0x40 - 0x5F    Address of bytecode when character is not equal         */ \
+  /* 0x60 - 0x7F    Address of bytecode when load is out of range           */ \
+  V(CHECK_NOT_CHAR_AT, 59, 16)                                                 \
+  /* Combination of:                                                        */ \
+  /* LOAD_CURRENT_CHAR_UNCHECKED and CHECK_NOT_CHAR                         */ \
+  /* Emitted by RegExpBytecodePeepholeOptimization.                         */ \
+  /* Bit Layout:                                                            */ \
+  /* 0x00 - 0x07    0x3C (fixed) Bytecode                                   */ \
+  /* 0x08 - 0x1F    Load character offset from current position             */ \
+  /* 0x20 - 0x3F    Character to check                                      */ \
+  /* 0x40 - 0x5F    Address of bytecode when character is not equal         */ \
+  V(CHECK_NOT_CHAR_AT_UNCHECKED, 60, 12)                                       \
+  /* Combination of:                                                        */ \
+  /* LOAD_2_CURRENT_CHARS_UNCHECKED and CHECK_NOT_CHAR                      */ \
+  /* Emitted by RegExpBytecodePeepholeOptimization.                         */ \
+  /* Bit Layout:                                                            */ \
+  /* 0x00 - 0x07    0x3D (fixed) Bytecode                                   */ \
+  /* 0x08 - 0x1F    Load characters offset from current position            */ \
+  /* 0x20 - 0x3F    Characters to check                                     */ \
+  /* 0x40 - 0x5F    Address of bytecode when characters are not equal       */ \
+  V(CHECK_NOT_2_CHARS_AT_UNCHECKED, 61, 12)                                    \
+  /* Combination of:                                                        */ \
+  /* LOAD_4_CURRENT_CHARS_UNCHECKED and CHECK_NOT_4_CHARS                   */ \
+  /* Emitted by RegExpBytecodePeepholeOptimization.                         */ \
+  /* Bit Layout:                                                            */ \
+  /* 0x00 - 0x07    0x3E (fixed) Bytecode                                   */ \
+  /* 0x08 - 0x1F    Load characters offset from current position            */ \
+  /* 0x20 - 0x3F    Characters to check                                     */ \
+  /* 0x40 - 0x5F    Address of bytecode when characters are not equal       */ \
+  V(CHECK_NOT_4_CHARS_AT_UNCHECKED, 62, 12)
 
 #define COUNT(...) +1
 static constexpr int kRegExpBytecodeCount = BYTECODE_ITERATOR(COUNT);
@@ -221,7 +258,7 @@ static constexpr int kRegExpBytecodeCount = BYTECODE_ITERATOR(COUNT);
 // contiguous, strictly increasing, and start at 0.
 // TODO(jgruber): Do not explicitly assign values, instead generate them
 // implicitly from the list order.
-static_assert(kRegExpBytecodeCount == 59);
+static_assert(kRegExpBytecodeCount == 63);
 
 #define DECLARE_BYTECODES(name, code, length) \
   static constexpr int BC_##name = code;
@@ -416,13 +416,8 @@ IrregexpInterpreter::Result RawMatch(
 // Fill dispatch table from last defined bytecode up to the next power of two
 // with BREAK (invalid operation).
 // TODO(pthier): Find a way to fill up automatically (at compile time)
-// 59 real bytecodes -> 5 fillers
-#define BYTECODE_FILLER_ITERATOR(V) \
-  V(BREAK) /* 1 */                  \
-  V(BREAK) /* 2 */                  \
-  V(BREAK) /* 3 */                  \
-  V(BREAK) /* 4 */                  \
-  V(BREAK) /* 5 */
+// 63 real bytecodes -> 1 filler
+#define BYTECODE_FILLER_ITERATOR(V) V(BREAK) /* 1 */
 
 #define COUNT(...) +1
   static constexpr int kRegExpBytecodeFillerCount =
@@ -1037,6 +1032,60 @@ IrregexpInterpreter::Result RawMatch(
       SET_PC_FROM_OFFSET(Load32Aligned(pc + 16));
       DISPATCH();
     }
+    BYTECODE(CHECK_NOT_CHAR_AT) {
+      int pos = current + LoadPacked24Signed(insn);
+      if (!IndexIsInBounds(pos, subject.length())) {
+        SET_PC_FROM_OFFSET(Load32Aligned(pc + 12));
+        DISPATCH();
+      }
+      current_char = subject[pos];
+      uint32_t c = Load32Aligned(pc + 4);
+      if (c != current_char) {
+        SET_PC_FROM_OFFSET(Load32Aligned(pc + 8));
+      } else {
+        ADVANCE(CHECK_NOT_CHAR_AT);
+      }
+      DISPATCH();
+    }
+    BYTECODE(CHECK_NOT_CHAR_AT_UNCHECKED) {
+      int pos = current + LoadPacked24Signed(insn);
+      current_char = subject[pos];
+      uint32_t c = Load32Aligned(pc + 4);
+      if (c != current_char) {
+        SET_PC_FROM_OFFSET(Load32Aligned(pc + 8));
+      } else {
+        ADVANCE(CHECK_NOT_CHAR_AT_UNCHECKED);
+      }
+      DISPATCH();
+    }
+    BYTECODE(CHECK_NOT_2_CHARS_AT_UNCHECKED) {
+      int pos = current + LoadPacked24Signed(insn);
+      Char next = subject[pos + 1];
+      current_char = (subject[pos] | (next << (kBitsPerByte * sizeof(Char))));
+      uint32_t c = Load32Aligned(pc + 4);
+      if (c != current_char) {
+        SET_PC_FROM_OFFSET(Load32Aligned(pc + 8));
+      } else {
+        ADVANCE(CHECK_NOT_2_CHARS_AT_UNCHECKED);
+      }
+      DISPATCH();
+    }
+    BYTECODE(CHECK_NOT_4_CHARS_AT_UNCHECKED) {
+      DCHECK_EQ(1, sizeof(Char));
+      int pos = current + LoadPacked24Signed(insn);
+      Char next1 = subject[pos + 1];
+      Char next2 = subject[pos + 2];
+      Char next3 = subject[pos + 3];
+      current_char =
+          (subject[pos] | (next1 << 8) | (next2 << 16) | (next3 << 24));
+      uint32_t c = Load32Aligned(pc + 4);
+      if (c != current_char) {
+        SET_PC_FROM_OFFSET(Load32Aligned(pc + 8));
+      } else {
+        ADVANCE(CHECK_NOT_4_CHARS_AT_UNCHECKED);
+      }
+      DISPATCH();
+    }
 #if V8_USE_COMPUTED_GOTO
 // Lint gets confused a lot if we just use !V8_USE_COMPUTED_GOTO or ifndef
 // V8_USE_COMPUTED_GOTO here.
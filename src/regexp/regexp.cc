@@ -11,6 +11,7 @@
 #include "src/heap/heap-inl.h"
 #include "src/objects/js-regexp-inl.h"
 #include "src/regexp/experimental/experimental.h"
+#include "src/regexp/regexp-bytecode-cache.h"
 #include "src/regexp/regexp-bytecode-generator.h"
 #include "src/regexp/regexp-bytecodes.h"
 #include "src/regexp/regexp-compiler.h"
@@ -38,7 +39,8 @@ class RegExpImpl final : public AllStatic {
   // Prepares a JSRegExp object with Irregexp-specific data.
   static void IrregexpInitialize(Isolate* isolate, Handle<JSRegExp> re,
                                  Handle<String> pattern, RegExpFlags flags,
-                                 int capture_count, uint32_t backtrack_limit);
+                                 int capture_count, uint32_t backtrack_limit,
+                                 MaybeHandle<String> prefilter);
 
   // Prepare a RegExp for being executed one or more times (using
   // IrregexpExecOnce) on the subject.
@@ -190,6 +192,85 @@ bool HasFewDifferentCharacters(Handle<String> pattern) {
   return true;
 }
 
+// Shorter literal prefixes occur too often for skipping ahead to pay off, and
+// longer ones are truncated.
+constexpr int kMinPrefilterLength = 3;
+constexpr int kMaxPrefilterLength = 64;
+
+// Appends the characters that every match of `tree` starts with to `prefix`.
+// Returns true if all of `tree` is literal, i.e. if the literal prefix of
+// whatever follows `tree` may be appended as well.
+bool AppendLiteralPrefix(RegExpTree* tree, RegExpFlags flags,
+                         std::vector<base::uc16>* prefix) {
+  if (tree->IsAtom()) {
+    base::Vector<const base::uc16> data = tree->AsAtom()->data();
+    prefix->insert(prefix->end(), data.begin(), data.end());
+    return true;
+  }
+  if (tree->IsText()) {
+    for (TextElement& element : *tree->AsText()->elements()) {
+      if (element.text_type() != TextElement::ATOM ||
+          !AppendLiteralPrefix(element.atom(), flags, prefix)) {
+        return false;
+      }
+    }
+    return true;
+  }
+  if (tree->IsAlternative()) {
+    for (RegExpTree* node : *tree->AsAlternative()->nodes()) {
+      if (!AppendLiteralPrefix(node, flags, prefix)) return false;
+    }
+    return true;
+  }
+  if (tree->IsCapture()) {
+    return AppendLiteralPrefix(tree->AsCapture()->body(), flags, prefix);
+  }
+  if (tree->IsGroup()) {
+    // Modifiers may change how the group's characters are matched.
+    RegExpGroup* group = tree->AsGroup();
+    return group->flags() == flags &&
+           AppendLiteralPrefix(group->body(), flags, prefix);
+  }
+  // Assertions, lookarounds and empty terms do not consume any input.
+  if (tree->IsAssertion() || tree->IsLookaround() || tree->IsEmpty()) {
+    return true;
+  }
+  if (tree->IsQuantifier()) {
+    RegExpQuantifier* quantifier = tree->AsQuantifier();
+    if (quantifier->min() > 0) {
+      AppendLiteralPrefix(quantifier->body(), flags, prefix);
+    }
+    return false;
+  }
+  return false;
+}
+
+// Returns a literal that every match of the regexp starts with, if it is long
+// enough for skipping to its occurrences with a string search to be
+// worthwhile.
+MaybeHandle<String> ComputePrefilter(Isolate* isolate, RegExpTree* tree,
+                                     RegExpFlags flags) {
+  if (!v8_flags.regexp_prefilter) return {};
+  // Sticky regexps only match at lastIndex and anchored ones only at the
+  // start of the subject, so there is nothing to skip.
+  if (IsIgnoreCase(flags) || IsSticky(flags) || tree->IsAnchoredAtStart()) {
+    return {};
+  }
+  std::vector<base::uc16> prefix;
+  AppendLiteralPrefix(tree, flags, &prefix);
+  if (prefix.size() < static_cast<size_t>(kMinPrefilterLength)) return {};
+  // In unicode mode, matching must not start in the middle of a surrogate
+  // pair.
+  if (unibrow::Utf16::IsLeadSurrogate(prefix[0]) ||
+      unibrow::Utf16::IsTrailSurrogate(prefix[0])) {
+    return {};
+  }
+  prefix.resize(std::min<size_t>(prefix.size(), kMaxPrefilterLength));
+  return isolate->factory()
+      ->NewStringFromTwoByte(base::VectorOf(prefix))
+      .ToHandleChecked();
+}
+
 }  // namespace
 
 // Generic RegExp methods. Dispatches to implementation specific methods.
@@ -270,9 +351,23 @@ MaybeHandle<Object> RegExp::Compile(Isolate* isolate, Handle<JSRegExp> re,
       has_been_compiled = true;
     }
   }
+  if (!has_been_compiled &&
+      v8_flags.default_to_experimental_regexp_engine_with_dfa &&
+      v8_flags.regexp_lazy_dfa &&
+      ExperimentalRegExp::CanBeHandled(parse_result.tree, pattern, flags,
+                                       parse_result.capture_count) &&
+      ExperimentalRegExp::CanBeHandledByDfa(parse_result.tree, flags, &zone)) {
+    DCHECK(v8_flags.enable_experimental_regexp_engine);
+    ExperimentalRegExp::Initialize(isolate, re, pattern, flags,
+                                   parse_result.capture_count);
+    has_been_compiled = true;
+  }
   if (!has_been_compiled) {
+    MaybeHandle<String> prefilter =
+        ComputePrefilter(isolate, parse_result.tree, flags);
     RegExpImpl::IrregexpInitialize(isolate, re, pattern, flags,
-                                   parse_result.capture_count, backtrack_limit);
+                                   parse_result.capture_count, backtrack_limit,
+                                   prefilter);
   }
   DCHECK(IsFixedArray(re->data()));
   // Compilation succeeded so the data is set on the regexp
@@ -509,6 +604,24 @@ struct RegExpCaptureIndexLess {
   }
 };
 
+// Creates a capture name map with {count} entries. {capture_at}(i) returns the
+// name and the index of the i-th named capture, in order of their indices.
+template <typename CaptureAt>
+Handle<FixedArray> NewCaptureNameMap(Isolate* isolate, int count,
+                                     CaptureAt capture_at) {
+  DCHECK_LT(0, count);
+  Handle<FixedArray> array = isolate->factory()->NewFixedArray(count * 2);
+  for (int i = 0; i < count; i++) {
+    auto [capture_name, index] = capture_at(i);
+    // CSA code in ConstructNewResultFromMatchInfo requires these strings to be
+    // internalized so they can be used as property names in the 'exec' results.
+    Handle<String> name = isolate->factory()->InternalizeString(capture_name);
+    array->set(i * 2, *name);
+    array->set(i * 2 + 1, Smi::FromInt(index));
+  }
+  return array;
+}
+
 }  // namespace
 
 // static
@@ -524,26 +637,63 @@ Handle<FixedArray> RegExp::CreateCaptureNameMap(
   std::sort(named_captures->begin(), named_captures->end(),
             RegExpCaptureIndexLess{});
 
-  int len = static_cast<int>(named_captures->size()) * 2;
-  Handle<FixedArray> array = isolate->factory()->NewFixedArray(len);
+  return NewCaptureNameMap(
+      isolate, static_cast<int>(named_captures->size()), [&](int i) {
+        const RegExpCapture* capture = named_captures->at(i);
+        return std::make_pair(
+            base::Vector<const base::uc16>(capture->name()->data(),
+                                           capture->name()->size()),
+            capture->index());
+      });
+}
 
-  int i = 0;
-  for (const RegExpCapture* capture : *named_captures) {
-    base::Vector<const base::uc16> capture_name(capture->name()->data(),
-                                                capture->name()->size());
-    // CSA code in ConstructNewResultFromMatchInfo requires these strings to be
-    // internalized so they can be used as property names in the 'exec' results.
-    Handle<String> name = isolate->factory()->InternalizeString(capture_name);
-    array->set(i * 2, *name);
-    array->set(i * 2 + 1, Smi::FromInt(capture->index()));
+namespace {
+
+std::vector<base::uc16> BytecodeCacheSource(Handle<String> pattern) {
+  DisallowGarbageCollection no_gc;
+  String::FlatContent content = pattern->GetFlatContent(no_gc);
+  if (content.IsOneByte()) {
+    base::Vector<const uint8_t> chars = content.ToOneByteVector();
+    return std::vector<base::uc16>(chars.begin(), chars.end());
+  }
+  base::Vector<const base::uc16> chars = content.ToUC16Vector();
+  return std::vector<base::uc16>(chars.begin(), chars.end());
+}
 
-    i++;
+void SetIrregexpBytecodeFromCache(Isolate* isolate, Handle<JSRegExp> re,
+                                  bool is_one_byte,
+                                  const RegExpBytecodeCache::Entry& entry) {
+  Factory* factory = isolate->factory();
+  Handle<ByteArray> bytecode =
+      factory->NewByteArray(static_cast<int>(entry.bytecode.size()));
+  MemCopy(bytecode->begin(), entry.bytecode.data(), entry.bytecode.size());
+
+  Handle<FixedArray> capture_name_map;
+  if (!entry.named_captures.empty()) {
+    capture_name_map = NewCaptureNameMap(
+        isolate, static_cast<int>(entry.named_captures.size()), [&](int i) {
+          const auto& [chars, index] = entry.named_captures[i];
+          return std::make_pair(
+              base::Vector<const base::uc16>(chars.data(), chars.size()),
+              index);
+        });
   }
-  DCHECK_EQ(i * 2, len);
 
-  return array;
+  Handle<FixedArray> data =
+      Handle<FixedArray>(FixedArray::cast(re->data()), isolate);
+  data->set(JSRegExp::bytecode_index(is_one_byte), *bytecode);
+  Handle<Code> trampoline = BUILTIN_CODE(isolate, RegExpInterpreterTrampoline);
+  data->set(JSRegExp::code_index(is_one_byte), trampoline->wrapper());
+  re->set_capture_name_map(capture_name_map);
+  if (entry.register_count > RegExpImpl::IrregexpMaxRegisterCount(*data)) {
+    RegExpImpl::SetIrregexpMaxRegisterCount(*data, entry.register_count);
+  }
+  data->set(JSRegExp::kIrregexpBacktrackLimit,
+            Smi::FromInt(entry.backtrack_limit));
 }
 
+}  // namespace
+
 bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
                                  Handle<String> sample_subject,
                                  bool is_one_byte) {
@@ -557,6 +707,24 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
 
   Handle<String> pattern(re->source(), isolate);
   pattern = String::Flatten(isolate, pattern);
+
+  // Bytecode compiled by another isolate can be reused. The sample subject only
+  // tunes the generated code, so bytecode compiled for a different sample is
+  // still correct.
+  std::optional<RegExpBytecodeCache::Key> cache_key;
+  if (v8_flags.regexp_shared_bytecode_cache && re->ShouldProduceBytecode() &&
+      !v8_flags.print_regexp_bytecode) {
+    cache_key.emplace(RegExpBytecodeCache::Key{
+        BytecodeCacheSource(pattern), flags, is_one_byte,
+        re->backtrack_limit(), FlagList::Hash()});
+    std::shared_ptr<const RegExpBytecodeCache::Entry> entry =
+        GetProcessWideRegExpBytecodeCache()->Lookup(*cache_key);
+    if (entry) {
+      SetIrregexpBytecodeFromCache(isolate, re, is_one_byte, *entry);
+      return true;
+    }
+  }
+
   RegExpCompileData compile_data;
   if (!RegExpParser::ParseRegExpFromHeapString(isolate, &zone, pattern, flags,
                                                &compile_data)) {
@@ -613,6 +781,28 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
   }
   data->set(JSRegExp::kIrregexpBacktrackLimit, Smi::FromInt(backtrack_limit));
 
+  if (cache_key.has_value()) {
+    DCHECK_EQ(compile_data.compilation_target,
+              RegExpCompilationTarget::kBytecode);
+    // CreateCaptureNameMap has sorted the named captures by index.
+    auto entry = std::make_shared<RegExpBytecodeCache::Entry>();
+    Tagged<ByteArray> bytecode = ByteArray::cast(*compile_data.code);
+    entry->bytecode.assign(bytecode->begin(),
+                           bytecode->begin() + bytecode->length());
+    entry->register_count = compile_data.register_count;
+    entry->backtrack_limit = backtrack_limit;
+    if (compile_data.named_captures != nullptr) {
+      for (const RegExpCapture* capture : *compile_data.named_captures) {
+        entry->named_captures.emplace_back(
+            std::vector<base::uc16>(capture->name()->begin(),
+                                    capture->name()->end()),
+            capture->index());
+      }
+    }
+    GetProcessWideRegExpBytecodeCache()->Insert(std::move(*cache_key),
+                                                std::move(entry));
+  }
+
   if (v8_flags.trace_regexp_tier_up) {
     PrintF("JSRegExp object %p %s size: %d\n",
            reinterpret_cast<void*>(re->ptr()),
@@ -652,11 +842,12 @@ Tagged<Code> RegExpImpl::IrregexpNativeCode(IsolateForSandbox isolate,
 void RegExpImpl::IrregexpInitialize(Isolate* isolate, Handle<JSRegExp> re,
                                     Handle<String> pattern, RegExpFlags flags,
                                     int capture_count,
-                                    uint32_t backtrack_limit) {
+                                    uint32_t backtrack_limit,
+                                    MaybeHandle<String> prefilter) {
   // Initialize compiled code entries to null.
-  isolate->factory()->SetRegExpIrregexpData(re, pattern,
-                                            JSRegExp::AsJSRegExpFlags(flags),
-                                            capture_count, backtrack_limit);
+  isolate->factory()->SetRegExpIrregexpData(
+      re, pattern, JSRegExp::AsJSRegExpFlags(flags), capture_count,
+      backtrack_limit, prefilter);
 }
 
 // static
@@ -685,6 +876,14 @@ int RegExpImpl::IrregexpExecRaw(Isolate* isolate, Handle<JSRegExp> regexp,
   DCHECK_GE(output_size,
             JSRegExp::RegistersForCaptureCount(regexp->capture_count()));
 
+  // Skip ahead to the first position at which a match can start.
+  Tagged<Object> prefilter = regexp->prefilter();
+  if (!IsSmi(prefilter)) {
+    index = String::IndexOf(isolate, subject,
+                            handle(String::cast(prefilter), isolate), index);
+    if (index == -1) return RegExp::RE_FAILURE;
+  }
+
   bool is_one_byte = String::IsOneByteRepresentationUnderneath(*subject);
 
   if (!regexp->ShouldProduceBytecode()) {
@@ -1076,11 +1275,9 @@ RegExpGlobalCache::RegExpGlobalCache(Handle<JSRegExp> regexp,
     case JSRegExp::NOT_COMPILED:
       UNREACHABLE();
     case JSRegExp::ATOM: {
-      // ATOM regexps do not have a global loop, so we search for one match at
-      // a time.
       static const int kAtomRegistersPerMatch = 2;
       registers_per_match_ = kAtomRegistersPerMatch;
-      register_array_size_ = registers_per_match_;
+      register_array_size_ = kBatchRegisterCount;
       break;
     }
     case JSRegExp::IRREGEXP: {
@@ -1096,8 +1293,8 @@ RegExpGlobalCache::RegExpGlobalCache(Handle<JSRegExp> regexp,
         register_array_size_ = registers_per_match_;
         max_matches_ = 1;
       } else {
-        register_array_size_ = std::max(
-            {registers_per_match_, Isolate::kJSRegexpStaticOffsetsVectorSize});
+        register_array_size_ =
+            std::max(registers_per_match_, kBatchRegisterCount);
       }
       break;
     }
@@ -1110,19 +1307,22 @@ RegExpGlobalCache::RegExpGlobalCache(Handle<JSRegExp> regexp,
       }
       registers_per_match_ =
           JSRegExp::RegistersForCaptureCount(regexp->capture_count());
-      register_array_size_ = std::max(
-          {registers_per_match_, Isolate::kJSRegexpStaticOffsetsVectorSize});
+      register_array_size_ =
+          std::max(registers_per_match_, kBatchRegisterCount);
       break;
     }
   }
 
   max_matches_ = register_array_size_ / registers_per_match_;
 
-  if (register_array_size_ > Isolate::kJSRegexpStaticOffsetsVectorSize) {
-    register_array_ = NewArray<int32_t>(register_array_size_);
-  } else {
-    register_array_ = isolate->jsregexp_static_offsets_vector();
+  // Take the isolate's reusable register array. Nested global matches, e.g.
+  // from interrupts, find it taken and allocate their own.
+  register_array_storage_.swap(*isolate->regexp_global_cache_registers());
+  if (register_array_storage_.size() <
+      static_cast<size_t>(register_array_size_)) {
+    register_array_storage_.resize(register_array_size_);
   }
+  register_array_ = register_array_storage_.data();
 
   // Set state so that fetching the results the first time triggers a call
   // to the compiled regexp.
@@ -1137,10 +1337,12 @@ RegExpGlobalCache::RegExpGlobalCache(Handle<JSRegExp> regexp,
 }
 
 RegExpGlobalCache::~RegExpGlobalCache() {
-  // Deallocate the register array if we allocated it in the constructor
-  // (as opposed to using the existing jsregexp_static_offsets_vector).
-  if (register_array_size_ > Isolate::kJSRegexpStaticOffsetsVectorSize) {
-    DeleteArray(register_array_);
+  // Hand the register array back to the isolate unless it is too large to
+  // keep around or the isolate already holds a larger one.
+  std::vector<int32_t>* reusable = isolate_->regexp_global_cache_registers();
+  if (register_array_storage_.size() <= kMaxReusedRegisterCount &&
+      register_array_storage_.size() > reusable->size()) {
+    reusable->swap(register_array_storage_);
   }
 }
 
@@ -5,6 +5,8 @@
 #ifndef V8_REGEXP_REGEXP_H_
 #define V8_REGEXP_REGEXP_H_
 
+#include <vector>
+
 #include "src/common/assert-scope.h"
 #include "src/handles/handles.h"
 #include "src/regexp/regexp-error.h"
@@ -191,6 +193,12 @@ class RegExpGlobalCache final {
   bool HasException() { return num_matches_ < 0; }
 
  private:
+  // Number of registers reserved for a batch of matches, so that the regexp
+  // code is entered once per batch rather than once per match.
+  static constexpr int kBatchRegisterCount = 1024;
+  // Larger register arrays are freed instead of being kept for reuse.
+  static constexpr size_t kMaxReusedRegisterCount = 4 * kBatchRegisterCount;
+
   int AdvanceZeroLength(int last_index);
 
   int num_matches_;
@@ -200,6 +208,9 @@ class RegExpGlobalCache final {
   // Pointer to the last set of captures.
   int32_t* register_array_;
   int register_array_size_;
+  // Owns the register array. It is taken from the isolate and handed back on
+  // destruction, so that consecutive global matches do not allocate.
+  std::vector<int32_t> register_array_storage_;
   Handle<JSRegExp> regexp_;
   Handle<String> subject_;
   Isolate* isolate_;
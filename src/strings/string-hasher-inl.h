@@ -10,6 +10,8 @@
 // Comment inserted to prevent header reordering.
 #include <type_traits>
 
+#include "src/base/bits.h"
+#include "src/base/memory.h"
 #include "src/objects/name-inl.h"
 #include "src/objects/string-inl.h"
 #include "src/strings/char-predicates-inl.h"
@@ -46,6 +48,89 @@ uint32_t StringHasher::GetTrivialHash(int length) {
   return String::CreateHashFieldValue(hash, String::HashFieldType::kHash);
 }
 
+namespace detail {
+
+// Constants from rapidhash, which in turn inherits them from wyhash.
+constexpr uint64_t kWordHashSecret[2] = {0x2d358dccaa6c78a5,
+                                         0x8bb84b93962eacc9};
+
+// Replaces |a| and |b| with the low and high halves of their 128-bit product.
+V8_INLINE void WordHashMultiply(uint64_t* a, uint64_t* b) {
+#ifdef __SIZEOF_INT128__
+  unsigned __int128 product = *a * static_cast<unsigned __int128>(*b);
+  *a = static_cast<uint64_t>(product);
+  *b = static_cast<uint64_t>(product >> 64);
+#else
+  uint64_t high = base::bits::UnsignedMulHigh64(*a, *b);
+  *a *= *b;
+  *b = high;
+#endif
+}
+
+V8_INLINE uint64_t WordHashMix(uint64_t a, uint64_t b) {
+  WordHashMultiply(&a, &b);
+  return a ^ b;
+}
+
+// Reads four code units into the 16-bit lanes of a word, the first one in the
+// lowest lane. One-byte characters are zero-extended, so that a string hashes
+// the same no matter whether it is stored as one-byte or two-byte.
+template <typename uchar>
+V8_INLINE uint64_t ReadFourCodeUnits(const uchar* chars) {
+#if defined(V8_TARGET_LITTLE_ENDIAN)
+  if constexpr (sizeof(uchar) == 1) {
+    uint64_t word =
+        base::ReadUnalignedValue<uint32_t>(reinterpret_cast<Address>(chars));
+    word = (word | (word << 16)) & 0x0000ffff0000ffff;
+    return (word | (word << 8)) & 0x00ff00ff00ff00ff;
+  } else {
+    return base::ReadUnalignedValue<uint64_t>(reinterpret_cast<Address>(chars));
+  }
+#else
+  return static_cast<uint64_t>(chars[0]) |
+         static_cast<uint64_t>(chars[1]) << 16 |
+         static_cast<uint64_t>(chars[2]) << 32 |
+         static_cast<uint64_t>(chars[3]) << 48;
+#endif
+}
+
+// A rapidhash-style hash that consumes eight code units per multiplication
+// instead of mixing in one character at a time.
+template <typename uchar>
+V8_INLINE uint32_t HashCodeUnits(const uchar* chars, int length,
+                                 uint64_t seed) {
+  uint64_t state =
+      seed ^ WordHashMix(seed ^ kWordHashSecret[0], kWordHashSecret[1]);
+  const uchar* end = chars + length;
+  while (end - chars > 8) {
+    state = WordHashMix(ReadFourCodeUnits(chars) ^ kWordHashSecret[1],
+                        ReadFourCodeUnits(chars + 4) ^ state);
+    chars += 8;
+  }
+  // The remaining 0 to 8 code units. Longer tails are read as two words that
+  // may overlap; the length is mixed in below to tell them apart.
+  uint64_t a = 0;
+  uint64_t b = 0;
+  const ptrdiff_t remaining = end - chars;
+  if (remaining >= 4) {
+    a = ReadFourCodeUnits(chars);
+    b = ReadFourCodeUnits(end - 4);
+  } else if (remaining > 0) {
+    a = static_cast<uint64_t>(chars[0]) << 32 |
+        static_cast<uint64_t>(chars[remaining >> 1]) << 16 |
+        static_cast<uint64_t>(end[-1]);
+  }
+  a ^= kWordHashSecret[1];
+  b ^= state;
+  WordHashMultiply(&a, &b);
+  uint64_t hash = WordHashMix(
+      a ^ kWordHashSecret[0] ^ static_cast<uint64_t>(length),
+      b ^ kWordHashSecret[1]);
+  return static_cast<uint32_t>(hash) ^ static_cast<uint32_t>(hash >> 32);
+}
+
+}  // namespace detail
+
 template <typename char_t>
 uint32_t StringHasher::HashSequentialString(const char_t* chars_raw, int length,
                                             uint64_t seed) {
@@ -112,14 +197,10 @@ uint32_t StringHasher::HashSequentialString(const char_t* chars_raw, int length,
   }
 
   // Non-index hash.
-  uint32_t running_hash = static_cast<uint32_t>(seed);
-  const uchar* end = &chars[length];
-  while (chars != end) {
-    running_hash = AddCharacterCore(running_hash, *chars++);
-  }
-
-  return String::CreateHashFieldValue(GetHashCore(running_hash),
-                                      String::HashFieldType::kHash);
+  uint32_t hash = detail::HashCodeUnits(chars, length, seed);
+  // Ensure that the hash is kZeroHash, if the computed value is 0.
+  if ((hash & String::HashBits::kMax) == 0) hash |= kZeroHash;
+  return String::CreateHashFieldValue(hash, String::HashFieldType::kHash);
 }
 
 std::size_t SeededStringHasher::operator()(const char* name) const {
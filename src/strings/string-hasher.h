@@ -35,7 +35,8 @@ class V8_EXPORT_PRIVATE StringHasher final {
   // use 27 instead.
   static const int kZeroHash = 27;
 
-  // Reusable parts of the hashing algorithm.
+  // Parts of the one-at-a-time hash that is used for integer indices. Other
+  // strings are hashed several characters at a time.
   V8_INLINE static uint32_t AddCharacterCore(uint32_t running_hash, uint16_t c);
   V8_INLINE static uint32_t GetHashCore(uint32_t running_hash);
 
@@ -54,12 +54,42 @@ struct DecoderTraits<StrictUtf8Decoder> {
   using DfaDecoder = Utf8DfaDecoder;
 };
 #endif  // V8_ENABLE_WEBASSEMBLY
+
+bool IsContinuationByte(uint8_t byte) { return (byte & 0xC0) == 0x80; }
+
+// Decodes a well-formed two- or three-byte sequence, which is what most
+// non-ASCII text consists of, without stepping through the DFA byte by byte.
+// Sequences that are ill-formed, encode surrogates, take four bytes or are cut
+// off by {end} are left to the DFA. Returns the number of bytes consumed, or 0.
+V8_INLINE int DecodeTwoOrThreeByteSequence(const uint8_t* cursor,
+                                           const uint8_t* end,
+                                           uint32_t* code_point) {
+  const uint8_t lead = cursor[0];
+  if (lead >= 0xC2 && lead <= 0xDF) {
+    if (end - cursor < 2 || !IsContinuationByte(cursor[1])) return 0;
+    *code_point = ((lead & 0x1F) << 6) | (cursor[1] & 0x3F);
+    return 2;
+  }
+  if (lead >= 0xE0 && lead <= 0xEF) {
+    if (end - cursor < 3 || !IsContinuationByte(cursor[1]) ||
+        !IsContinuationByte(cursor[2])) {
+      return 0;
+    }
+    const uint32_t value =
+        ((lead & 0x0F) << 12) | ((cursor[1] & 0x3F) << 6) | (cursor[2] & 0x3F);
+    // Overlong encodings and surrogates.
+    if (value < 0x800 || (value & 0xF800) == 0xD800) return 0;
+    *code_point = value;
+    return 3;
+  }
+  return 0;
+}
 }  // namespace
 
 template <class Decoder>
 Utf8DecoderBase<Decoder>::Utf8DecoderBase(base::Vector<const uint8_t> data)
     : encoding_(Encoding::kAscii),
-      non_ascii_start_(NonAsciiStart(data.begin(), data.length())),
+      non_ascii_start_(AsciiPrefixLength(data.begin(), data.length())),
       utf16_length_(non_ascii_start_) {
   using Traits = DecoderTraits<Decoder>;
   if (non_ascii_start_ == data.length()) return;
@@ -72,14 +102,26 @@ Utf8DecoderBase<Decoder>::Utf8DecoderBase(base::Vector<const uint8_t> data)
   const uint8_t* end = data.begin() + data.length();
 
   while (cursor < end) {
-    if (V8_LIKELY(*cursor <= unibrow::Utf8::kMaxOneByteChar &&
-                  state == Traits::DfaDecoder::kAccept)) {
+    if (V8_LIKELY(state == Traits::DfaDecoder::kAccept)) {
       DCHECK_EQ(0u, current);
-      DCHECK(!Traits::IsInvalidSurrogatePair(previous, *cursor));
-      previous = *cursor;
-      utf16_length_++;
-      cursor++;
-      continue;
+      if (*cursor <= unibrow::Utf8::kMaxOneByteChar) {
+        int ascii_length =
+            AsciiPrefixLength(cursor, static_cast<int>(end - cursor));
+        DCHECK(!Traits::IsInvalidSurrogatePair(previous, *cursor));
+        previous = cursor[ascii_length - 1];
+        utf16_length_ += ascii_length;
+        cursor += ascii_length;
+        continue;
+      }
+      uint32_t code_point;
+      if (int length = DecodeTwoOrThreeByteSequence(cursor, end, &code_point)) {
+        DCHECK(!Traits::IsInvalidSurrogatePair(previous, code_point));
+        is_one_byte = is_one_byte && code_point <= unibrow::Latin1::kMaxChar;
+        previous = code_point;
+        utf16_length_++;
+        cursor += length;
+        continue;
+      }
     }
 
     auto previous_state = state;
@@ -141,12 +183,23 @@ void Utf8DecoderBase<Decoder>::Decode(Char* out,
   const uint8_t* end = data.begin() + data.length();
 
   while (cursor < end) {
-    if (V8_LIKELY(*cursor <= unibrow::Utf8::kMaxOneByteChar &&
-                  state == Traits::DfaDecoder::kAccept)) {
+    if (V8_LIKELY(state == Traits::DfaDecoder::kAccept)) {
       DCHECK_EQ(0u, current);
-      *(out++) = static_cast<Char>(*cursor);
-      cursor++;
-      continue;
+      if (*cursor <= unibrow::Utf8::kMaxOneByteChar) {
+        int ascii_length =
+            AsciiPrefixLength(cursor, static_cast<int>(end - cursor));
+        CopyChars(out, cursor, ascii_length);
+        out += ascii_length;
+        cursor += ascii_length;
+        continue;
+      }
+      uint32_t code_point;
+      if (int length = DecodeTwoOrThreeByteSequence(cursor, end, &code_point)) {
+        DCHECK(sizeof(Char) == 2 || code_point <= unibrow::Latin1::kMaxChar);
+        *(out++) = static_cast<Char>(code_point);
+        cursor += length;
+        continue;
+      }
     }
 
     auto previous_state = state;
@@ -5,7 +5,9 @@
 #ifndef V8_STRINGS_UNICODE_DECODER_H_
 #define V8_STRINGS_UNICODE_DECODER_H_
 
+#include "src/base/memory.h"
 #include "src/base/vector.h"
+#include "src/json/json-simd.h"
 #include "src/strings/unicode.h"
 
 namespace v8 {
@@ -48,6 +50,32 @@ inline int NonAsciiStart(const uint8_t* chars, int length) {
   return static_cast<int>(chars - start);
 }
 
+// Returns the number of ASCII characters at the start of {chars}. Unlike
+// NonAsciiStart, the result is exact. Checks 16 bytes per step, with SSE2 or
+// Neon where available.
+inline int AsciiPrefixLength(const uint8_t* chars, int length) {
+  const uint8_t* cursor = chars;
+  const uint8_t* limit = chars + length;
+  DCHECK_EQ(unibrow::Utf8::kMaxOneByteChar, 0x7F);
+#ifdef V8_JSON_SIMD
+  cursor = JsonSimdFind(cursor, limit, JsonSimdIsNonAscii);
+#else
+  constexpr uint64_t kNonAsciiMask = 0x8080808080808080;
+  while (limit - cursor >= 16) {
+    uint64_t first =
+        base::ReadUnalignedValue<uint64_t>(reinterpret_cast<Address>(cursor));
+    uint64_t second = base::ReadUnalignedValue<uint64_t>(
+        reinterpret_cast<Address>(cursor + 8));
+    if ((first | second) & kNonAsciiMask) break;
+    cursor += 16;
+  }
+#endif  // V8_JSON_SIMD
+  while (cursor < limit && *cursor <= unibrow::Utf8::kMaxOneByteChar) {
+    ++cursor;
+  }
+  return static_cast<int>(cursor - chars);
+}
+
 template <class Decoder>
 class Utf8DecoderBase {
  public:
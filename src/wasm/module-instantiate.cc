@@ -94,6 +94,95 @@ class CompileImportWrapperJob final : public JobTask {
   WasmImportWrapperCache::ModificationScope* const cache_scope_;
 };
 
+// A copy of (part of) an active data segment into a memory.
+struct DataSegmentCopy {
+  uint8_t* dst;
+  const uint8_t* src;
+  size_t size;
+};
+
+// Copies data segments into memories, using multiple threads. The copies must
+// not overlap each other in the destination.
+class CopyDataSegmentsJob final : public JobTask {
+ public:
+  explicit CopyDataSegmentsJob(base::Vector<const DataSegmentCopy> copies)
+      : copies_(copies) {}
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    size_t next = next_copy_.load(std::memory_order_relaxed);
+    return next >= copies_.size() ? 0 : copies_.size() - next;
+  }
+
+  void Run(JobDelegate* delegate) override {
+    TRACE_EVENT0("v8.wasm", "wasm.CopyDataSegmentsJob.Run");
+    while (true) {
+      size_t index = next_copy_.fetch_add(1, std::memory_order_relaxed);
+      if (index >= copies_.size()) return;
+      const DataSegmentCopy& copy = copies_[index];
+      std::memcpy(copy.dst, copy.src, copy.size);
+      if (delegate->ShouldYield()) return;
+    }
+  }
+
+ private:
+  const base::Vector<const DataSegmentCopy> copies_;
+  std::atomic<size_t> next_copy_{0};
+};
+
+// Segments smaller than this in total are copied on the main thread.
+constexpr size_t kMinParallelDataSegmentCopySize = 1 * MB;
+// Size of the chunks that large segments are split into for parallel copying.
+constexpr size_t kDataSegmentCopyChunkSize = 256 * KB;
+
+// Performs the given copies in order. If they are large enough and don't
+// overlap, they are split into chunks and copied in parallel.
+void CopyDataSegments(std::vector<DataSegmentCopy> copies) {
+  size_t total_size = 0;
+  for (const DataSegmentCopy& copy : copies) total_size += copy.size;
+
+  bool copy_in_parallel =
+      total_size >= kMinParallelDataSegmentCopySize &&
+      V8::GetCurrentPlatform()->NumberOfWorkerThreads() > 0;
+  if (copy_in_parallel) {
+    // Later segments overwrite earlier ones, so overlapping copies have to be
+    // done sequentially.
+    std::vector<DataSegmentCopy> sorted = copies;
+    std::sort(sorted.begin(), sorted.end(),
+              [](const DataSegmentCopy& a, const DataSegmentCopy& b) {
+                return a.dst < b.dst;
+              });
+    for (size_t i = 1; i < sorted.size(); ++i) {
+      if (sorted[i - 1].dst + sorted[i - 1].size > sorted[i].dst) {
+        copy_in_parallel = false;
+        break;
+      }
+    }
+  }
+
+  if (!copy_in_parallel) {
+    for (const DataSegmentCopy& copy : copies) {
+      std::memcpy(copy.dst, copy.src, copy.size);
+    }
+    return;
+  }
+
+  std::vector<DataSegmentCopy> chunks;
+  chunks.reserve(total_size / kDataSegmentCopyChunkSize + copies.size());
+  for (const DataSegmentCopy& copy : copies) {
+    for (size_t offset = 0; offset < copy.size;
+         offset += kDataSegmentCopyChunkSize) {
+      chunks.push_back({copy.dst + offset, copy.src + offset,
+                        std::min(kDataSegmentCopyChunkSize,
+                                 copy.size - offset)});
+    }
+  }
+  auto copy_job = V8::GetCurrentPlatform()->CreateJob(
+      TaskPriority::kUserBlocking,
+      std::make_unique<CopyDataSegmentsJob>(base::VectorOf(chunks)));
+  // Wait for the job to finish, while contributing in this thread.
+  copy_job->Join();
+}
+
 Handle<Map> CreateStructMap(Isolate* isolate, const WasmModule* module,
                             int struct_index, Handle<Map> opt_rtt_parent,
                             Handle<WasmInstanceObject> instance) {
@@ -1707,6 +1796,10 @@ void InstanceBuilder::LoadDataSegments(
     Handle<WasmTrustedInstanceData> shared_trusted_instance_data) {
   base::Vector<const uint8_t> wire_bytes =
       module_object_->native_module()->wire_bytes();
+  // Collect the copies first and perform them in one go, so that large
+  // segments can be copied in parallel. On error, all segments preceding the
+  // failing one are still copied, as required by the spec.
+  std::vector<DataSegmentCopy> copies;
   for (const WasmDataSegment& segment : module_->data_segments) {
     uint32_t size = segment.source.length();
 
@@ -1719,7 +1812,7 @@ void InstanceBuilder::LoadDataSegments(
       ValueOrError result = EvaluateConstantExpression(
           &init_expr_zone_, segment.dest_addr, kWasmI64, isolate_,
           trusted_instance_data, shared_trusted_instance_data);
-      if (MaybeMarkError(result, thrower_)) return;
+      if (MaybeMarkError(result, thrower_)) break;
       uint64_t dest_offset_64 = to_value(result).to_u64();
 
       // Clamp to {std::numeric_limits<size_t>::max()}, which is always an
@@ -1731,7 +1824,7 @@ void InstanceBuilder::LoadDataSegments(
       ValueOrError result = EvaluateConstantExpression(
           &init_expr_zone_, segment.dest_addr, kWasmI32, isolate_,
           trusted_instance_data, shared_trusted_instance_data);
-      if (MaybeMarkError(result, thrower_)) return;
+      if (MaybeMarkError(result, thrower_)) break;
       dest_offset = to_value(result).to_u32();
     }
 
@@ -1743,14 +1836,15 @@ void InstanceBuilder::LoadDataSegments(
           "data segment %zu is out of bounds (offset %zu, "
           "length %u, memory size %zu)",
           segment_index, dest_offset, size, memory_size);
-      return;
+      break;
     }
 
     uint8_t* memory_base =
         trusted_instance_data->memory_base(segment.memory_index);
-    std::memcpy(memory_base + dest_offset,
-                wire_bytes.begin() + segment.source.offset(), size);
+    copies.push_back({memory_base + dest_offset,
+                      wire_bytes.begin() + segment.source.offset(), size});
   }
+  CopyDataSegments(std::move(copies));
 }
 
 void InstanceBuilder::WriteGlobalValue(const WasmGlobal& global,
@@ -6392,10 +6392,37 @@ class TurboshaftGraphBuildingInterface : public WasmGraphBuilderBase {
         enforce_bounds_check ==
             compiler::EnforceBoundsCheck::kCanOmitBoundsCheck) {
       if (memory->is_memory64) {
+        const uint64_t guards_size = memory->GetMemory64GuardsSize();
+        // A constant index can be checked against the guard regions at
+        // compile time.
+        if (index.valid() && __ output_graph().Get(index).Is<ConstantOp>()) {
+          uint64_t constant_index =
+              __ output_graph().Get(index).Cast<ConstantOp>().word64();
+          if (constant_index < guards_size) {
+            return {converted_index,
+                    compiler::BoundsCheckResult::kTrapHandler};
+          }
+          return {__ UintPtrConstant(memory->max_memory_size),
+                  compiler::BoundsCheckResult::kTrapHandler};
+        }
+        // An index that was zero-extended from 32 bits (e.g. via
+        // i64.extend_i32_u) is below 4GB, so no runtime check is needed if
+        // the guard regions cover at least 4GB beyond the maximum memory
+        // size (the static offset is already known to be below that).
+        if (guards_size - memory->max_memory_size > kMaxUInt32 &&
+            index.valid()) {
+          if (const ChangeOp* change =
+                  __ output_graph().Get(index).TryCast<ChangeOp>();
+              change && change->kind == ChangeOp::Kind::kZeroExtend &&
+              change->from == RegisterRepresentation::Word32()) {
+            return {converted_index,
+                    compiler::BoundsCheckResult::kTrapHandler};
+          }
+        }
+
         Label<WordPtr> no_oom(&asm_);
-        V<Word32> cond = __ UintPtrLessThan(
-            converted_index,
-            __ UintPtrConstant(memory->GetMemory64GuardsSize()));
+        V<Word32> cond = __ UintPtrLessThan(converted_index,
+                                            __ UintPtrConstant(guards_size));
         GOTO_IF(LIKELY(cond), no_oom, converted_index);
 
         // This will cause a memory access at memory[max_memory_size + offset],
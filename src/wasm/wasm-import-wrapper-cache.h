@@ -48,7 +48,8 @@ class WasmImportWrapperCache {
    public:
     size_t operator()(const CacheKey& key) const {
       return base::hash_combine(static_cast<uint8_t>(key.kind),
-                                key.canonical_type_index, key.expected_arity);
+                                key.canonical_type_index, key.expected_arity,
+                                static_cast<uint8_t>(key.suspend));
     }
   };
 
@@ -9,6 +9,11 @@
 #include "include/v8-array-buffer.h"
 #include "include/v8-cppgc.h"
 #include "include/v8-initialization.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-primitive.h"
+#include "include/v8-script.h"
+#include "src/base/macros.h"
+
 namespace v8::benchmarking {
 
 // static
@@ -45,4 +50,52 @@ void BenchmarkWithIsolate::ShutdownProcess() {
   delete v8_ab_allocator_;
 }
 
+void BenchmarkWithContext::SetUp(::benchmark::State& state) {
+  v8::HandleScope handle_scope(v8_isolate());
+  v8::Local<v8::Context> context = v8::Context::New(v8_isolate());
+  context_.Reset(v8_isolate(), context);
+  context->Enter();
+  if (setup_script_ != nullptr) RunScript(setup_script_);
+}
+
+void BenchmarkWithContext::TearDown(::benchmark::State& state) {
+  v8::HandleScope handle_scope(v8_isolate());
+  v8_context()->Exit();
+  context_.Reset();
+}
+
+v8::Local<v8::Script> BenchmarkWithContext::CompileScript(const char* source) {
+  v8::EscapableHandleScope handle_scope(v8_isolate());
+  v8::Local<v8::String> v8_source =
+      v8::String::NewFromUtf8(v8_isolate(), source).ToLocalChecked();
+  v8::Local<v8::Script> script =
+      v8::Script::Compile(v8_context(), v8_source).ToLocalChecked();
+  return handle_scope.Escape(script);
+}
+
+v8::Local<v8::Value> BenchmarkWithContext::RunScript(const char* source) {
+  v8::EscapableHandleScope handle_scope(v8_isolate());
+  v8::Local<v8::Value> result =
+      CompileScript(source)->Run(v8_context()).ToLocalChecked();
+  return handle_scope.Escape(result);
+}
+
+void BenchmarkWithContext::RunScriptBenchmark(::benchmark::State& state,
+                                              const char* source,
+                                              int warmup_runs) {
+  v8::HandleScope handle_scope(v8_isolate());
+  v8::Local<v8::Context> context = v8_context();
+  v8::Local<v8::Script> script = CompileScript(source);
+  for (int i = 0; i < warmup_runs; i++) {
+    v8::HandleScope warmup_handle_scope(v8_isolate());
+    script->Run(context).ToLocalChecked();
+  }
+  for (auto _ : state) {
+    USE(_);
+    v8::HandleScope iteration_handle_scope(v8_isolate());
+    v8::Local<v8::Value> result = script->Run(context).ToLocalChecked();
+    benchmark::DoNotOptimize(result);
+  }
+}
+
 }  // namespace v8::benchmarking
@@ -6,8 +6,10 @@
 #define TEST_BENCHMARK_CPP_BENCHMARK_UTILS_H_
 
 #include "include/v8-array-buffer.h"
+#include "include/v8-context.h"
 #include "include/v8-cppgc.h"
 #include "include/v8-isolate.h"
+#include "include/v8-persistent-handle.h"
 #include "include/v8-platform.h"
 #include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
 
@@ -36,6 +38,35 @@ class BenchmarkWithIsolate : public benchmark::Fixture {
   static v8::ArrayBuffer::Allocator* v8_ab_allocator_;
 };
 
+// BenchmarkWithContext additionally creates and enters a fresh context for each
+// benchmark and provides helpers for running scripts in it. If a
+// {setup_script} is given, it is run in the new context before each benchmark.
+class BenchmarkWithContext : public BenchmarkWithIsolate {
+ public:
+  explicit BenchmarkWithContext(const char* setup_script = nullptr)
+      : setup_script_(setup_script) {}
+
+  void SetUp(::benchmark::State& state) override;
+  void TearDown(::benchmark::State& state) override;
+
+ protected:
+  V8_INLINE v8::Local<v8::Context> v8_context() {
+    return context_.Get(v8_isolate());
+  }
+
+  v8::Local<v8::Script> CompileScript(const char* source);
+  v8::Local<v8::Value> RunScript(const char* source);
+
+  // Compiles {source} once, runs it {warmup_runs} times, and then runs it once
+  // per iteration of {state}.
+  void RunScriptBenchmark(::benchmark::State& state, const char* source,
+                          int warmup_runs = 0);
+
+ private:
+  const char* const setup_script_;
+  v8::Global<v8::Context> context_;
+};
+
 }  // namespace v8::benchmarking
 
 #endif  // TEST_BENCHMARK_CPP_BENCHMARK_UTILS_H_
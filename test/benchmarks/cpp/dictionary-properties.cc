@@ -0,0 +1,71 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures objects that are used as hash maps, i.e. that go to dictionary mode
+// because properties are added and deleted all the time. Compare builds with
+// v8_enable_swiss_name_dictionary = true (SwissNameDictionary) and false
+// (NameDictionary).
+
+#include "test/benchmarks/cpp/benchmark-utils.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace {
+
+const char* kSetupScript = R"(
+  const kKeys = [];
+  for (let i = 0; i < 1024; i++) kKeys.push('key' + i);
+
+  function makeMap(size) {
+    const map = {};
+    for (let i = 0; i < size; i++) map[kKeys[i]] = i;
+    // Deleting a property that isn't the last one added makes {map} a
+    // dictionary mode object.
+    delete map[kKeys[0]];
+    map[kKeys[0]] = 0;
+    return map;
+  }
+  const kSmallMap = makeMap(16);
+  const kLargeMap = makeMap(1024);
+
+  // Looks up every key of {map}, plus the same number of missing keys.
+  function lookup(map, size) {
+    let sum = 0;
+    for (let i = 0; i < size; i++) {
+      sum += map[kKeys[i]];
+      if (map['missing' + (i & 7)] !== undefined) sum++;
+    }
+    return sum;
+  }
+
+  // Deletes and re-adds keys of {map}, which leaves deleted entries behind
+  // that later lookups have to skip.
+  function churn(map, size) {
+    for (let i = 0; i < size; i += 3) delete map[kKeys[i]];
+    for (let i = 0; i < size; i += 3) map[kKeys[i]] = i;
+    return lookup(map, size);
+  }
+)";
+
+class DictionaryProperties : public v8::benchmarking::BenchmarkWithContext {
+ public:
+  DictionaryProperties() : BenchmarkWithContext(kSetupScript) {}
+};
+
+}  // namespace
+
+BENCHMARK_F(DictionaryProperties, LookupSmall)(benchmark::State& st) {
+  RunScriptBenchmark(st, "lookup(kSmallMap, 16)");
+}
+
+BENCHMARK_F(DictionaryProperties, LookupLarge)(benchmark::State& st) {
+  RunScriptBenchmark(st, "lookup(kLargeMap, 1024)");
+}
+
+BENCHMARK_F(DictionaryProperties, ChurnSmall)(benchmark::State& st) {
+  RunScriptBenchmark(st, "churn(kSmallMap, 16)");
+}
+
+BENCHMARK_F(DictionaryProperties, ChurnLarge)(benchmark::State& st) {
+  RunScriptBenchmark(st, "churn(kLargeMap, 1024)");
+}
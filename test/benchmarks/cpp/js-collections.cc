@@ -0,0 +1,142 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures lookups in and updates of Maps and Sets, which are backed by
+// OrderedHashMap and OrderedHashSet. Every benchmark runs with a table that
+// fits into the L1 cache and with tables of one and four million entries,
+// which don't fit into any cache. The size of the backing store is reported
+// as the "table_bytes" counter.
+
+#include <string>
+
+#include "src/api/api-inl.h"
+#include "src/objects/js-collection-inl.h"
+#include "test/benchmarks/cpp/benchmark-utils.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace {
+
+namespace i = v8::internal;
+
+const char* kSetupScript = R"(
+  let kSmis, kObjects, kStrings;
+  let kSmiMap, kObjectMap, kStringMap, kObjectSet;
+
+  function makeMap(keys) {
+    const map = new Map();
+    for (let i = 0; i < keys.length; i++) map.set(keys[i], i);
+    return map;
+  }
+
+  function setUp(size) {
+    kSmis = [];
+    kObjects = [];
+    kStrings = [];
+    for (let i = 0; i < size; i++) {
+      kSmis.push(i);
+      kObjects.push({i});
+      kStrings.push('key' + i);
+    }
+    kSmiMap = makeMap(kSmis);
+    kObjectMap = makeMap(kObjects);
+    kStringMap = makeMap(kStrings);
+    kObjectSet = new Set(kObjects);
+  }
+
+  // Looks up every key of {map}, plus the same number of missing keys.
+  function get(map, keys) {
+    let sum = 0;
+    for (let i = 0; i < keys.length; i++) {
+      sum += map.get(keys[i]);
+      if (map.get(-1 - i) !== undefined) sum++;
+    }
+    return sum;
+  }
+
+  function has(set, keys) {
+    let count = 0;
+    for (let i = 0; i < keys.length; i++) {
+      if (set.has(keys[i])) count++;
+      if (set.has(i + 0.5)) count++;
+    }
+    return count;
+  }
+
+  // Deletes and re-adds a third of the keys of {map}, which leaves deleted
+  // entries behind until the map is rehashed.
+  function churn(map, keys) {
+    for (let i = 0; i < keys.length; i += 3) map.delete(keys[i]);
+    for (let i = 0; i < keys.length; i += 3) map.set(keys[i], i);
+    return get(map, keys);
+  }
+
+  // Builds a new Map from scratch, which grows it several times.
+  function build(keys) {
+    return makeMap(keys).size;
+  }
+)";
+
+class JSCollections : public v8::benchmarking::BenchmarkWithContext {
+ public:
+  JSCollections() : BenchmarkWithContext(kSetupScript) {}
+
+  void SetUp(::benchmark::State& state) override {
+    BenchmarkWithContext::SetUp(state);
+    std::string set_up = "setUp(" + std::to_string(state.range(0)) + ")";
+    RunScript(set_up.c_str());
+  }
+
+ protected:
+  // Reports the size of the backing store of the Map or Set {name}.
+  void ReportTableSize(::benchmark::State& state, const char* name) {
+    v8::HandleScope handle_scope(v8_isolate());
+    i::Tagged<i::JSCollection> collection =
+        i::JSCollection::cast(*v8::Utils::OpenDirectHandle(*RunScript(name)));
+    state.counters["table_bytes"] =
+        i::HeapObject::cast(collection->table())->Size();
+  }
+};
+
+void TableSizes(benchmark::internal::Benchmark* b) {
+  b->Arg(4 * 1024)->Arg(1024 * 1024)->Arg(4 * 1024 * 1024);
+}
+
+}  // namespace
+
+BENCHMARK_DEFINE_F(JSCollections, MapGetSmi)(benchmark::State& st) {
+  RunScriptBenchmark(st, "get(kSmiMap, kSmis)");
+  ReportTableSize(st, "kSmiMap");
+}
+BENCHMARK_REGISTER_F(JSCollections, MapGetSmi)->Apply(TableSizes);
+
+BENCHMARK_DEFINE_F(JSCollections, MapGetObject)(benchmark::State& st) {
+  RunScriptBenchmark(st, "get(kObjectMap, kObjects)");
+  ReportTableSize(st, "kObjectMap");
+}
+BENCHMARK_REGISTER_F(JSCollections, MapGetObject)->Apply(TableSizes);
+
+BENCHMARK_DEFINE_F(JSCollections, MapGetString)(benchmark::State& st) {
+  RunScriptBenchmark(st, "get(kStringMap, kStrings)");
+  ReportTableSize(st, "kStringMap");
+}
+BENCHMARK_REGISTER_F(JSCollections, MapGetString)->Apply(TableSizes);
+
+BENCHMARK_DEFINE_F(JSCollections, SetHasObject)(benchmark::State& st) {
+  RunScriptBenchmark(st, "has(kObjectSet, kObjects)");
+  ReportTableSize(st, "kObjectSet");
+}
+BENCHMARK_REGISTER_F(JSCollections, SetHasObject)->Apply(TableSizes);
+
+BENCHMARK_DEFINE_F(JSCollections, MapChurnObject)(benchmark::State& st) {
+  RunScriptBenchmark(st, "churn(kObjectMap, kObjects)");
+  ReportTableSize(st, "kObjectMap");
+}
+BENCHMARK_REGISTER_F(JSCollections, MapChurnObject)->Apply(TableSizes);
+
+// The built Map has the same size as kStringMap.
+BENCHMARK_DEFINE_F(JSCollections, MapBuildString)(benchmark::State& st) {
+  RunScriptBenchmark(st, "build(kStrings)");
+  ReportTableSize(st, "kStringMap");
+}
+BENCHMARK_REGISTER_F(JSCollections, MapBuildString)->Apply(TableSizes);
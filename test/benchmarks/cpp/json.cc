@@ -0,0 +1,107 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/v8-context.h"
+#include "include/v8-json.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-primitive.h"
+#include "src/base/macros.h"
+#include "test/benchmarks/cpp/benchmark-utils.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace {
+
+// Builds an API-response-like payload of roughly 1MB with long string values,
+// escapes, large numbers and nesting. |suffix| is appended to every string
+// value; a non-Latin1 suffix turns the payload into a two-byte string.
+const char* kMakePayloadScript = R"(
+  function makePayload(suffix, indent) {
+    const items = [];
+    for (let i = 0; i < 2000; i++) {
+      items.push({
+        id: 1000000000 + i,
+        score: i * 1.25e-3,
+        active: i % 3 == 0,
+        name: 'item number ' + i + ' ' + suffix,
+        description: 'A somewhat longer description for item ' + i +
+            ' that contains "quoted" text, a \\ backslash and a\nnewline. ' +
+            suffix,
+        tags: ['alpha', 'beta', 'gamma' + suffix],
+        location: {lat: 52.520008 + i, lng: 13.404954 - i, zoom: null},
+      });
+    }
+    return JSON.stringify({count: items.length, items}, null, indent);
+  }
+)";
+
+class JsonParse : public v8::benchmarking::BenchmarkWithContext {
+ public:
+  void SetUp(::benchmark::State& state) override {
+    BenchmarkWithContext::SetUp(state);
+    v8::HandleScope handle_scope(v8_isolate());
+    RunScript(kMakePayloadScript);
+  }
+
+ protected:
+  void RunBenchmark(::benchmark::State& state, const char* make_payload) {
+    v8::HandleScope handle_scope(v8_isolate());
+    v8::Local<v8::Context> context = v8_context();
+    v8::Local<v8::String> payload = RunScript(make_payload).As<v8::String>();
+    for (auto _ : state) {
+      USE(_);
+      v8::HandleScope iteration_handle_scope(v8_isolate());
+      v8::Local<v8::Value> result =
+          v8::JSON::Parse(context, payload).ToLocalChecked();
+      benchmark::DoNotOptimize(result);
+    }
+    state.SetBytesProcessed(state.iterations() * payload->Length() *
+                            (payload->IsOneByte() ? 1 : 2));
+  }
+};
+
+class JsonStringify : public JsonParse {
+ protected:
+  void RunBenchmark(::benchmark::State& state, const char* make_payload) {
+    v8::HandleScope handle_scope(v8_isolate());
+    v8::Local<v8::Context> context = v8_context();
+    v8::Local<v8::String> payload = RunScript(make_payload).As<v8::String>();
+    v8::Local<v8::Value> object =
+        v8::JSON::Parse(context, payload).ToLocalChecked();
+    for (auto _ : state) {
+      USE(_);
+      v8::HandleScope iteration_handle_scope(v8_isolate());
+      v8::Local<v8::String> result =
+          v8::JSON::Stringify(context, object).ToLocalChecked();
+      benchmark::DoNotOptimize(result);
+    }
+    state.SetBytesProcessed(state.iterations() * payload->Length() *
+                            (payload->IsOneByte() ? 1 : 2));
+  }
+};
+
+}  // namespace
+
+BENCHMARK_F(JsonParse, OneByte)(benchmark::State& st) {
+  RunBenchmark(st, "makePayload('', undefined)");
+}
+
+BENCHMARK_F(JsonParse, OneBytePretty)(benchmark::State& st) {
+  RunBenchmark(st, "makePayload('', 2)");
+}
+
+BENCHMARK_F(JsonParse, TwoByte)(benchmark::State& st) {
+  RunBenchmark(st, "makePayload('\\u2603', undefined)");
+}
+
+BENCHMARK_F(JsonParse, TwoBytePretty)(benchmark::State& st) {
+  RunBenchmark(st, "makePayload('\\u2603', 2)");
+}
+
+BENCHMARK_F(JsonStringify, OneByte)(benchmark::State& st) {
+  RunBenchmark(st, "makePayload('', undefined)");
+}
+
+BENCHMARK_F(JsonStringify, TwoByte)(benchmark::State& st) {
+  RunBenchmark(st, "makePayload('\\u2603', undefined)");
+}
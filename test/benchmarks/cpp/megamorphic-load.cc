@@ -0,0 +1,68 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures megamorphic property loads that see many more (map, name) pairs than
+// fit into the initial stub cache, like ORM code that reads the same fields
+// from thousands of record shapes. Compare against --no-adaptive-stub-cache,
+// and use --trace-stub-cache to see how the stub cache grows.
+//
+// Also measures loads that see a few more shapes than element accesses track,
+// which stay polymorphic up to --max-valid-polymorphic-named-map-count.
+
+#include "test/benchmarks/cpp/benchmark-utils.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace {
+
+// Creates objects with {shapes} different maps, each with the same 16
+// properties after a shape-specific prefix, and a driver that reads all of
+// them at a single megamorphic load site per property.
+const char* kSetupScript = R"(
+  function makeRecords(shapes) {
+    const records = [];
+    for (let i = 0; i < shapes; i++) {
+      const record = {};
+      record['tag' + i] = i;
+      for (let j = 0; j < 16; j++) record['field' + j] = j;
+      records.push(record);
+    }
+    return records;
+  }
+  function sumFields(records) {
+    let sum = 0;
+    for (const record of records) {
+      sum += record.field0 + record.field1 + record.field2 + record.field3 +
+             record.field4 + record.field5 + record.field6 + record.field7 +
+             record.field8 + record.field9 + record.field10 + record.field11 +
+             record.field12 + record.field13 + record.field14 + record.field15;
+    }
+    return sum;
+  }
+  const kEightShapes = makeRecords(8);
+  const kFewShapes = makeRecords(64);
+  const kManyShapes = makeRecords(4096);
+)";
+
+class MegamorphicLoad : public v8::benchmarking::BenchmarkWithContext {
+ public:
+  MegamorphicLoad() : BenchmarkWithContext(kSetupScript) {}
+};
+
+}  // namespace
+
+// 8 shapes stay polymorphic by default. Compare against
+// --max-valid-polymorphic-named-map-count=4, where they go megamorphic.
+BENCHMARK_F(MegamorphicLoad, EightShapes)(benchmark::State& st) {
+  RunScriptBenchmark(st, "sumFields(kEightShapes)");
+}
+
+// 64 shapes * 16 fields fit into the initial stub cache.
+BENCHMARK_F(MegamorphicLoad, FewShapes)(benchmark::State& st) {
+  RunScriptBenchmark(st, "sumFields(kFewShapes)");
+}
+
+// 4096 shapes * 16 fields thrash the initial stub cache.
+BENCHMARK_F(MegamorphicLoad, ManyShapes)(benchmark::State& st) {
+  RunScriptBenchmark(st, "sumFields(kManyShapes)");
+}
@@ -0,0 +1,68 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures the regexp bytecode interpreter on patterns dominated by literal
+// text, which is typical for the many cold regexps that never tier up. Run
+// with --regexp-interpret-all to stay in the interpreter, and compare against
+// --no-regexp-peephole-optimization to see the effect of superinstructions.
+
+#include "test/benchmarks/cpp/benchmark-utils.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace {
+
+// Builds ~100KB of log-like lines and defines drivers that scan them with
+// different kinds of patterns.
+const char* kSetupScript = R"(
+  const lines = [];
+  for (let i = 0; i < 2000; i++) {
+    lines.push('2024-05-' + (10 + i % 20) + ' INFO  [worker-' + (i % 8) +
+               '] request=' + i + ' status=200 path=/api/v1/items\n');
+  }
+  lines[1500] = '2024-05-20 ERROR [worker-3] request=1500 status=500\n';
+  const kLog = lines.join('');
+  const kTwoByteLog = kLog + '…';
+
+  function countMatches(re, subject) {
+    let count = 0;
+    re.lastIndex = 0;
+    while (re.exec(subject) !== null) count++;
+    return count;
+  }
+  function literal() {
+    return countMatches(/status=500/g, kLog);
+  }
+  function literalTwoByte() {
+    return countMatches(/status=500/g, kTwoByteLog);
+  }
+  function literalWithCaptures() {
+    return countMatches(/request=(\d+) status=(\d+)/g, kLog);
+  }
+  function alternation() {
+    return countMatches(/ERROR|WARN|FATAL/g, kLog);
+  }
+)";
+
+class RegExpInterpreter : public v8::benchmarking::BenchmarkWithContext {
+ public:
+  RegExpInterpreter() : BenchmarkWithContext(kSetupScript) {}
+};
+
+}  // namespace
+
+BENCHMARK_F(RegExpInterpreter, Literal)(benchmark::State& st) {
+  RunScriptBenchmark(st, "literal()");
+}
+
+BENCHMARK_F(RegExpInterpreter, LiteralTwoByte)(benchmark::State& st) {
+  RunScriptBenchmark(st, "literalTwoByte()");
+}
+
+BENCHMARK_F(RegExpInterpreter, LiteralWithCaptures)(benchmark::State& st) {
+  RunScriptBenchmark(st, "literalWithCaptures()");
+}
+
+BENCHMARK_F(RegExpInterpreter, Alternation)(benchmark::State& st) {
+  RunScriptBenchmark(st, "alternation()");
+}
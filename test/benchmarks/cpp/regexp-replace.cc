@@ -0,0 +1,74 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "test/benchmarks/cpp/benchmark-utils.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace {
+
+// Builds a ~500KB HTML-like template of 10000 list items and defines
+// drivers for typical templating and escaping workloads on it.
+const char* kSetupScript = R"(
+  const parts = [];
+  for (let i = 0; i < 10000; i++) {
+    parts.push('<li class="item">  {{name' + (i % 10) + '}} & {{value}}' +
+               '\t</li>\n');
+  }
+  const kTemplate = parts.join('');
+  const kData = {value: 'v'};
+  for (let i = 0; i < 10; i++) kData['name' + i] = 'Name ' + i;
+
+  function expandWithFunction() {
+    return kTemplate.replace(/\{\{(\w+)\}\}/g, (match, key) => kData[key]);
+  }
+  function expandWithString() {
+    return kTemplate.replace(/\{\{name\d\}\}/g, 'name');
+  }
+  function collapseWhitespace() {
+    return kTemplate.replace(/\s+/g, ' ');
+  }
+  function escapeHtml() {
+    return kTemplate.replaceAll(/&/g, '&amp;')
+        .replaceAll(/</g, '&lt;')
+        .replaceAll(/>/g, '&gt;')
+        .replaceAll(/"/g, '&quot;');
+  }
+  function stripTags() {
+    return kTemplate.replace(/<[^>]*>/g, '');
+  }
+)";
+
+class RegExpReplace : public v8::benchmarking::BenchmarkWithContext {
+ public:
+  RegExpReplace() : BenchmarkWithContext(kSetupScript) {}
+
+ protected:
+  void RunBenchmark(::benchmark::State& state, const char* source) {
+    // Warm up to tier up the regexps to native code.
+    RunScriptBenchmark(state, source, 3);
+    state.SetItemsProcessed(state.iterations() * 10000);
+  }
+};
+
+}  // namespace
+
+BENCHMARK_F(RegExpReplace, ExpandWithFunction)(benchmark::State& st) {
+  RunBenchmark(st, "expandWithFunction()");
+}
+
+BENCHMARK_F(RegExpReplace, ExpandWithString)(benchmark::State& st) {
+  RunBenchmark(st, "expandWithString()");
+}
+
+BENCHMARK_F(RegExpReplace, CollapseWhitespace)(benchmark::State& st) {
+  RunBenchmark(st, "collapseWhitespace()");
+}
+
+BENCHMARK_F(RegExpReplace, EscapeHtml)(benchmark::State& st) {
+  RunBenchmark(st, "escapeHtml()");
+}
+
+BENCHMARK_F(RegExpReplace, StripTags)(benchmark::State& st) {
+  RunBenchmark(st, "stripTags()");
+}
@@ -0,0 +1,72 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures hashing of sequential strings of various lengths, as done when
+// internalizing strings and when using strings as Map and Set keys. The
+// Jenkins variants hash one character at a time like the previous hash did,
+// for comparison.
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "src/strings/string-hasher-inl.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace {
+
+constexpr uint64_t kSeed = 0x1234567890abcdef;
+
+template <typename Char>
+std::vector<Char> MakeChars(int length) {
+  std::vector<Char> chars(length);
+  for (int i = 0; i < length; i++) {
+    // Avoid a leading digit, which would take the array index path.
+    chars[i] = static_cast<Char>('a' + (i * 7) % 26);
+  }
+  return chars;
+}
+
+template <typename Char>
+uint32_t JenkinsHash(const Char* chars, int length, uint64_t seed) {
+  uint32_t running_hash = static_cast<uint32_t>(seed);
+  for (int i = 0; i < length; i++) {
+    running_hash = v8::internal::StringHasher::AddCharacterCore(running_hash,
+                                                                chars[i]);
+  }
+  return v8::internal::StringHasher::GetHashCore(running_hash);
+}
+
+template <typename Char>
+void HashSequentialString(benchmark::State& state) {
+  const int length = static_cast<int>(state.range(0));
+  std::vector<Char> chars = MakeChars<Char>(length);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        v8::internal::StringHasher::HashSequentialString<Char>(
+            chars.data(), length, kSeed));
+  }
+  state.SetBytesProcessed(state.iterations() * length * sizeof(Char));
+}
+
+template <typename Char>
+void Jenkins(benchmark::State& state) {
+  const int length = static_cast<int>(state.range(0));
+  std::vector<Char> chars = MakeChars<Char>(length);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(JenkinsHash(chars.data(), length, kSeed));
+  }
+  state.SetBytesProcessed(state.iterations() * length * sizeof(Char));
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(HashSequentialString, uint8_t)
+    ->RangeMultiplier(4)
+    ->Range(4, 16 * 1024);
+BENCHMARK_TEMPLATE(HashSequentialString, uint16_t)
+    ->RangeMultiplier(4)
+    ->Range(4, 16 * 1024);
+BENCHMARK_TEMPLATE(Jenkins, uint8_t)->RangeMultiplier(4)->Range(4, 16 * 1024);
+BENCHMARK_TEMPLATE(Jenkins, uint16_t)->RangeMultiplier(4)->Range(4, 16 * 1024);
@@ -0,0 +1,87 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures string internalization from many threads, each running its own
+// isolate. Run with --shared-string-table so that all isolates insert into the
+// same string table and contend on it.
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include <memory>
+
+#include "include/v8-array-buffer.h"
+#include "include/v8-isolate.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-primitive.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace {
+
+constexpr int kStringsPerIteration = 1000;
+
+class IsolateForThread {
+ public:
+  IsolateForThread()
+      : allocator_(v8::ArrayBuffer::Allocator::NewDefaultAllocator()) {
+    v8::Isolate::CreateParams create_params;
+    create_params.array_buffer_allocator = allocator_.get();
+    isolate_ = v8::Isolate::New(create_params);
+  }
+  ~IsolateForThread() { isolate_->Dispose(); }
+
+  v8::Isolate* isolate() const { return isolate_; }
+
+ private:
+  std::unique_ptr<v8::ArrayBuffer::Allocator> allocator_;
+  v8::Isolate* isolate_;
+};
+
+v8::Local<v8::String> Internalize(v8::Isolate* isolate, const char* chars,
+                                  int length) {
+  return v8::String::NewFromOneByte(isolate,
+                                    reinterpret_cast<const uint8_t*>(chars),
+                                    v8::NewStringType::kInternalized, length)
+      .ToLocalChecked();
+}
+
+}  // namespace
+
+// Every string is new, so every lookup inserts.
+static void StringTableInsert(benchmark::State& state) {
+  IsolateForThread thread_isolate;
+  v8::Isolate* isolate = thread_isolate.isolate();
+  v8::Isolate::Scope isolate_scope(isolate);
+  char buffer[32];
+  uint64_t counter = 0;
+  for (auto _ : state) {
+    v8::HandleScope handle_scope(isolate);
+    for (int i = 0; i < kStringsPerIteration; i++) {
+      int length = snprintf(buffer, sizeof(buffer), "s%d-%" PRIu64,
+                            state.thread_index(), counter++);
+      benchmark::DoNotOptimize(Internalize(isolate, buffer, length));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kStringsPerIteration);
+}
+
+// All threads internalize the same strings, so after the first iteration every
+// lookup hits.
+static void StringTableLookup(benchmark::State& state) {
+  IsolateForThread thread_isolate;
+  v8::Isolate* isolate = thread_isolate.isolate();
+  v8::Isolate::Scope isolate_scope(isolate);
+  char buffer[32];
+  for (auto _ : state) {
+    v8::HandleScope handle_scope(isolate);
+    for (int i = 0; i < kStringsPerIteration; i++) {
+      int length = snprintf(buffer, sizeof(buffer), "shared-%d", i);
+      benchmark::DoNotOptimize(Internalize(isolate, buffer, length));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kStringsPerIteration);
+}
+
+BENCHMARK(StringTableInsert)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(StringTableLookup)->ThreadRange(1, 32)->UseRealTime();
@@ -0,0 +1,82 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures UTF-8 validation and transcoding as done for external sources,
+// String::NewFromUtf8 and TextDecoder, on mostly ASCII, mostly Latin-1 and
+// CJK text.
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "src/base/vector.h"
+#include "src/strings/unicode-decoder.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace {
+
+constexpr int kLength = 64 * 1024;
+
+enum class Text { kAscii, kLatin1, kCjk };
+
+std::vector<uint8_t> MakeText(Text text) {
+  // Repeats {word} up to {kLength} bytes, cutting off at a character boundary.
+  std::string word;
+  switch (text) {
+    case Text::kAscii:
+      word = "function foo(bar) { return bar + 1; }\n";
+      break;
+    case Text::kLatin1:
+      word = "Gr\xC3\xBC\xC3\x9F"
+             "e, \xC3\xA9t\xC3\xA9 \xC3\xA0 la caf\xC3\xA9t\xC3\xA9ria. ";
+      break;
+    case Text::kCjk:
+      word = "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E\xE3\x81\xAE"
+             "\xE6\x96\x87\xE7\xAB\xA0\xE3\x80\x82";
+      break;
+  }
+  std::vector<uint8_t> bytes;
+  while (bytes.size() + word.size() <= kLength) {
+    bytes.insert(bytes.end(), word.begin(), word.end());
+  }
+  return bytes;
+}
+
+template <Text text>
+void Validate(benchmark::State& state) {
+  std::vector<uint8_t> bytes = MakeText(text);
+  auto data = v8::base::VectorOf(bytes);
+  for (auto _ : state) {
+    v8::internal::Utf8Decoder decoder(data);
+    benchmark::DoNotOptimize(decoder.utf16_length());
+  }
+  state.SetBytesProcessed(state.iterations() * bytes.size());
+}
+
+template <Text text>
+void Decode(benchmark::State& state) {
+  std::vector<uint8_t> bytes = MakeText(text);
+  auto data = v8::base::VectorOf(bytes);
+  std::vector<uint16_t> out(bytes.size());
+  for (auto _ : state) {
+    v8::internal::Utf8Decoder decoder(data);
+    if (decoder.is_one_byte()) {
+      decoder.Decode(reinterpret_cast<uint8_t*>(out.data()), data);
+    } else {
+      decoder.Decode(out.data(), data);
+    }
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetBytesProcessed(state.iterations() * bytes.size());
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(Validate, Text::kAscii);
+BENCHMARK_TEMPLATE(Validate, Text::kLatin1);
+BENCHMARK_TEMPLATE(Validate, Text::kCjk);
+BENCHMARK_TEMPLATE(Decode, Text::kAscii);
+BENCHMARK_TEMPLATE(Decode, Text::kLatin1);
+BENCHMARK_TEMPLATE(Decode, Text::kCjk);
@@ -10,6 +10,7 @@
 #include "test/cctest/cctest.h"
 #include "test/cctest/compiler/function-tester.h"
 #include "test/common/code-assembler-tester.h"
+#include "test/common/flag-utils.h"
 
 namespace v8 {
 namespace internal {
@@ -108,18 +109,15 @@ Handle<Code> CreateCodeOfKind(CodeKind kind) {
   return data.GenerateCodeCloseAndEscape();
 }
 
-}  // namespace
-
-TEST(TryProbeStubCache) {
+// Generates code that takes a receiver, a name and the expected handler (or
+// Smi zero for a miss), probes {stub_cache} and returns whether it found the
+// expected handler.
+Handle<Code> GenerateTryProbeStubCache(Isolate* isolate,
+                                       StubCache* stub_cache) {
   using Label = CodeStubAssembler::Label;
-  Isolate* isolate(CcTest::InitIsolateOnce());
   const int kNumParams = 3;
   CodeAssemblerTester data(isolate, JSParameterCount(kNumParams));
   AccessorAssembler m(data.state());
-
-  StubCache stub_cache(isolate);
-  stub_cache.Clear();
-
   {
     auto receiver = m.Parameter<Object>(1);
     auto name = m.Parameter<Name>(2);
@@ -130,7 +128,7 @@ TEST(TryProbeStubCache) {
     CodeStubAssembler::TVariable<MaybeObject> var_handler(&m);
     Label if_handler(&m), if_miss(&m);
 
-    m.TryProbeStubCache(&stub_cache, receiver, name, &if_handler, &var_handler,
+    m.TryProbeStubCache(stub_cache, receiver, name, &if_handler, &var_handler,
                         &if_miss);
     m.BIND(&if_handler);
     m.Branch(m.TaggedEqual(expected_handler, var_handler.value()), &passed,
@@ -146,8 +144,19 @@ TEST(TryProbeStubCache) {
     m.BIND(&failed);
     m.Return(m.BooleanConstant(false));
   }
+  return data.GenerateCodeCloseAndEscape();
+}
 
-  Handle<Code> code = data.GenerateCode();
+}  // namespace
+
+TEST(TryProbeStubCache) {
+  Isolate* isolate(CcTest::InitIsolateOnce());
+  const int kNumParams = 3;
+
+  StubCache stub_cache(isolate);
+  stub_cache.Clear();
+
+  Handle<Code> code = GenerateTryProbeStubCache(isolate, &stub_cache);
   FunctionTester ft(code, kNumParams);
 
   std::vector<Handle<Name>> names;
@@ -250,5 +259,56 @@ TEST(TryProbeStubCache) {
   CHECK(queried_existing && queried_non_existing);
 }
 
+TEST(TryProbeStubCacheAfterGrowing) {
+  FLAG_SCOPE(adaptive_stub_cache);
+  Isolate* isolate(CcTest::InitIsolateOnce());
+  const int kNumParams = 3;
+
+  StubCache stub_cache(isolate);
+  stub_cache.Clear();
+
+  Handle<Code> code = GenerateTryProbeStubCache(isolate, &stub_cache);
+  FunctionTester ft(code, kNumParams);
+
+  // Many more (name, map) pairs than fit into the largest tables.
+  const int kNameCount = 256;
+  const int kReceiverCount = 200;
+  Factory* factory = isolate->factory();
+  std::vector<Handle<Name>> names;
+  for (int i = 0; i < kNameCount; i++) {
+    std::string name = "name" + std::to_string(i);
+    names.push_back(factory->InternalizeUtf8String(name.c_str()));
+  }
+  std::vector<Handle<JSObject>> receivers;
+  for (int i = 0; i < kReceiverCount; i++) {
+    receivers.push_back(factory->NewJSObjectFromMap(Map::Create(isolate, 0)));
+  }
+  Handle<Code> handler = CreateCodeOfKind(CodeKind::FOR_TESTING);
+
+  DisallowGarbageCollection no_gc;
+  for (Handle<JSObject> receiver : receivers) {
+    for (Handle<Name> name : names) {
+      stub_cache.Set(*name, receiver->map(), *handler);
+    }
+  }
+  CHECK_EQ(StubCache::kMaxPrimaryTableSize,
+           stub_cache.table_size(StubCache::kPrimary));
+  CHECK_EQ(StubCache::kMaxSecondaryTableSize,
+           stub_cache.table_size(StubCache::kSecondary));
+
+  // Generated code has to find the same entries as the runtime.
+  int hits = 0;
+  for (Handle<JSObject> receiver : receivers) {
+    for (int i = 0; i < kNameCount; i += 7) {
+      Handle<Name> name = names[i];
+      Tagged<MaybeObject> found = stub_cache.Get(*name, receiver->map());
+      if (found.ptr() != kNullAddress) hits++;
+      Handle<Object> expected_handler(found.GetHeapObjectOrSmi(), isolate);
+      ft.CheckTrue(receiver, name, expected_handler);
+    }
+  }
+  CHECK_LT(0, hits);
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -48,6 +48,7 @@
 #include "include/v8-json.h"
 #include "include/v8-locker.h"
 #include "include/v8-primitive-object.h"
+#include "include/v8-profiler.h"
 #include "include/v8-regexp.h"
 #include "include/v8-util.h"
 #include "src/api/api-inl.h"
@@ -624,6 +625,55 @@ THREADED_TEST(ScriptUsingOneByteStringResource) {
 }
 
 
+THREADED_TEST(NewExternalUtf8) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  int dispose_count = 0;
+  char buffer[64];
+
+  // ASCII data is used as it is.
+  const char* c_ascii = "GET /index.html HTTP/1.1";
+  TestOneByteResource* resource =
+      new TestOneByteResource(i::StrDup(c_ascii), &dispose_count);
+  Local<String> ascii =
+      String::NewExternalUtf8(isolate, resource).ToLocalChecked();
+  CHECK(ascii->IsExternalOneByte());
+  CHECK_EQ(static_cast<const String::ExternalOneByteStringResource*>(resource),
+           ascii->GetExternalOneByteStringResource());
+  CHECK_EQ(0, dispose_count);
+  CHECK_EQ(static_cast<int>(strlen(c_ascii)) + 1,
+           ascii->WriteUtf8(isolate, buffer, sizeof(buffer)));
+  CHECK_EQ(0, strcmp(c_ascii, buffer));
+
+  // Other data is decoded, and the resource is disposed of.
+  const char* c_utf8 = "caf\xC3\xA9 \xE2\x98\x83";
+  Local<String> utf8 =
+      String::NewExternalUtf8(
+          isolate, new TestOneByteResource(i::StrDup(c_utf8), &dispose_count))
+          .ToLocalChecked();
+  CHECK(!utf8->IsExternal());
+  CHECK_EQ(1, dispose_count);
+  CHECK_EQ(6, utf8->Length());
+  CHECK(utf8->StringEquals(v8_str(c_utf8)));
+  CHECK_EQ(static_cast<int>(strlen(c_utf8)) + 1,
+           utf8->WriteUtf8(isolate, buffer, sizeof(buffer)));
+  CHECK_EQ(0, strcmp(c_utf8, buffer));
+
+  // One-byte strings with non-ASCII characters between longer ASCII runs.
+  const char* c_latin1 = "0123456789abcdef\xE9\xE8-0123456789abcdef\xFF";
+  const char* c_latin1_as_utf8 =
+      "0123456789abcdef\xC3\xA9\xC3\xA8-0123456789abcdef\xC3\xBF";
+  Local<String> latin1 =
+      String::NewFromOneByte(isolate,
+                             reinterpret_cast<const uint8_t*>(c_latin1))
+          .ToLocalChecked();
+  CHECK_EQ(static_cast<int>(strlen(c_latin1_as_utf8)) + 1,
+           latin1->WriteUtf8(isolate, buffer, sizeof(buffer)));
+  CHECK_EQ(0, strcmp(c_latin1_as_utf8, buffer));
+}
+
+
 THREADED_TEST(ScriptMakingExternalString) {
   int dispose_count = 0;
   uint16_t* two_byte_source = AsciiToTwoByteString(u"1 + 2 * 3 /* π */");
@@ -20949,6 +20999,62 @@ THREADED_TEST(JSONParseArray) {
                      i::PACKED_ELEMENTS);
 }
 
+namespace {
+Local<Value> JSONParseChunked(Local<Context> context, const std::string& json,
+                              size_t chunk_size) {
+  v8::JSON::ChunkedParser parser;
+  for (size_t i = 0; i < json.size(); i += chunk_size) {
+    parser.AddChunk(json.data() + i, std::min(chunk_size, json.size() - i));
+  }
+  return parser.Finish(context).ToLocalChecked();
+}
+}  // namespace
+
+THREADED_TEST(JSONParseChunked) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  HandleScope scope(isolate);
+  Local<Object> global = context->Global();
+
+  // Small ASCII input, and UTF-8 with a multi-byte character split across
+  // chunks.
+  for (size_t chunk_size : {1, 2, 3, 1000}) {
+    Local<Value> obj = JSONParseChunked(
+        context.local(),
+        "{\"x\": [1, \"a\\u00e9\"], \"y\": \"\xe2\x98\x83\"}", chunk_size);
+    global->Set(context.local(), v8_str("obj"), obj).FromJust();
+    ExpectTrue("obj.x[0] === 1 && obj.x[1] === 'a\\u00e9'");
+    ExpectTrue("obj.y === '\\u2603'");
+  }
+
+  // Large ASCII input, which is parsed from an external string.
+  std::string large = "[";
+  for (int i = 0; i < 1000; i++) {
+    if (i > 0) large += ",";
+    large += "{\"id\":" + std::to_string(i) + ",\"name\":\"item\"}";
+  }
+  large += "]";
+  Local<Value> array = JSONParseChunked(context.local(), large, 4096);
+  global->Set(context.local(), v8_str("array"), array).FromJust();
+  ExpectTrue("array.length === 1000 && array[999].id === 999");
+  ExpectTrue("array[500].name === 'item'");
+
+  // Syntax errors are thrown like for JSON::Parse.
+  {
+    v8::TryCatch try_catch(isolate);
+    v8::JSON::ChunkedParser parser;
+    parser.AddChunk("{\"x\":", 5);
+    CHECK(parser.Finish(context.local()).IsEmpty());
+    CHECK(try_catch.HasCaught());
+  }
+  {
+    v8::TryCatch try_catch(isolate);
+    v8::JSON::ChunkedParser parser;
+    CHECK(parser.Finish(context.local()).IsEmpty());
+    CHECK(try_catch.HasCaught());
+  }
+}
+
 THREADED_TEST(JSONStringifyObject) {
   LocalContext context;
   HandleScope scope(context->GetIsolate());
@@ -20977,6 +21083,103 @@ THREADED_TEST(JSONStringifyObjectWithGap) {
   ExpectString("JSON.stringify(obj, null,  '*')", *utf8);
 }
 
+namespace {
+
+class TestJSONOutputStream : public v8::OutputStream {
+ public:
+  explicit TestJSONOutputStream(int abort_after_chunks = -1)
+      : abort_after_chunks_(abort_after_chunks) {}
+  void EndOfStream() override { ++eos_signaled_; }
+  int GetChunkSize() override { return 64; }
+  WriteResult WriteAsciiChunk(char* data, int size) override {
+    CHECK_GT(size, 0);
+    CHECK_LE(size, GetChunkSize());
+    buffer_.append(data, size);
+    ++chunks_;
+    return chunks_ == abort_after_chunks_ ? kAbort : kContinue;
+  }
+  const std::string& buffer() const { return buffer_; }
+  int chunks() const { return chunks_; }
+  int eos_signaled() const { return eos_signaled_; }
+
+ private:
+  int abort_after_chunks_;
+  int chunks_ = 0;
+  int eos_signaled_ = 0;
+  std::string buffer_;
+};
+
+}  // namespace
+
+THREADED_TEST(JSONStringifyToStream) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  HandleScope scope(isolate);
+  // Large enough to be flushed many times, nested deeper than the fast path
+  // handles without a stack, and with Latin1 and two-byte characters,
+  // including surrogate pairs that may be split across flushes.
+  CompileRun(
+      "var obj = [];"
+      "for (var i = 0; i < 2000; i++) {"
+      "  obj.push({id: i, name: 'caf\u00e9 ' + i, s: 'x\ud83d\ude00\u4e2d'});"
+      "}"
+      "var nested = obj[0];"
+      "for (var i = 0; i < 20; i++) nested = nested.next = {depth: i};");
+  Local<Value> obj = CompileRun("obj");
+  v8::String::Utf8Value expected(isolate, CompileRun("JSON.stringify(obj)"));
+  {
+    TestJSONOutputStream stream;
+    CHECK(v8::JSON::StringifyToStream(context.local(), obj, &stream)
+              .FromJust());
+    CHECK_EQ(1, stream.eos_signaled());
+    CHECK_GT(stream.chunks(), 1);
+    CHECK_EQ(std::string(*expected, expected.length()), stream.buffer());
+  }
+  {
+    v8::String::Utf8Value expected_with_gap(
+        isolate, CompileRun("JSON.stringify(obj, null, '\u2003')"));
+    TestJSONOutputStream stream;
+    CHECK(v8::JSON::StringifyToStream(context.local(), obj, &stream,
+                                      v8_str("\u2003"))
+              .FromJust());
+    CHECK_EQ(std::string(*expected_with_gap, expected_with_gap.length()),
+             stream.buffer());
+  }
+  {
+    TestJSONOutputStream stream(3);
+    CHECK(!v8::JSON::StringifyToStream(context.local(), obj, &stream)
+               .FromJust());
+    CHECK_EQ(0, stream.eos_signaled());
+    CHECK_EQ(3, stream.chunks());
+  }
+  {
+    // Serialization stops once the stream is aborted, instead of calling
+    // toJSON for every remaining element.
+    Local<Value> to_json = CompileRun(
+        "var calls = 0;"
+        "var to_json = [];"
+        "for (var i = 0; i < 2000; i++) {"
+        "  to_json.push({toJSON() { calls++; return 'abcdefgh'.repeat(4); }});"
+        "}"
+        "to_json");
+    TestJSONOutputStream stream(1);
+    CHECK(!v8::JSON::StringifyToStream(context.local(), to_json, &stream)
+               .FromJust());
+    CHECK_EQ(0, stream.eos_signaled());
+    CHECK_EQ(1, stream.chunks());
+    CHECK_LT(CompileRun("calls")->Int32Value(context.local()).FromJust(), 100);
+  }
+  {
+    v8::TryCatch try_catch(isolate);
+    TestJSONOutputStream stream;
+    Local<Value> cyclic = CompileRun("var a = [obj]; a.push(a); a");
+    CHECK(v8::JSON::StringifyToStream(context.local(), cyclic, &stream)
+              .IsNothing());
+    CHECK(try_catch.HasCaught());
+    CHECK_EQ(0, stream.eos_signaled());
+  }
+}
+
 #if V8_OS_POSIX
 class ThreadInterruptTest {
  public:
@@ -535,12 +535,12 @@ TEST(SmallOrderedHashSetGetObjectProperties) {
   CheckProp(*props->properties[5],
             "v8::internal::TaggedMember<v8::internal::Object>", "data_table",
             d::PropertyKind::kArrayOfKnownSize,
-            number_of_buckets * OrderedHashMap::kLoadFactor);
+            number_of_buckets * SmallOrderedHashSet::kLoadFactor);
   CheckProp(*props->properties[6], "uint8_t", "hash_table",
             d::PropertyKind::kArrayOfKnownSize, number_of_buckets);
   CheckProp(*props->properties[7], "uint8_t", "chain_table",
             d::PropertyKind::kArrayOfKnownSize,
-            number_of_buckets * OrderedHashMap::kLoadFactor);
+            number_of_buckets * SmallOrderedHashSet::kLoadFactor);
 }
 
 }  // namespace internal
@@ -564,7 +564,8 @@ TEST(OrderedHashTableInsertion) {
 
   Handle<OrderedHashMap> map = factory->NewOrderedHashMap();
   Verify(isolate, map);
-  CHECK_EQ(2, map->NumberOfBuckets());
+  CHECK_EQ(4, map->NumberOfBuckets());
+  CHECK_EQ(3, map->Capacity());
   CHECK_EQ(0, map->NumberOfElements());
 
   // Add a new key.
@@ -573,14 +574,14 @@ TEST(OrderedHashTableInsertion) {
   CHECK(!OrderedHashMap::HasKey(isolate, *map, *key1));
   map = OrderedHashMap::Add(isolate, map, key1, value1).ToHandleChecked();
   Verify(isolate, map);
-  CHECK_EQ(2, map->NumberOfBuckets());
+  CHECK_EQ(4, map->NumberOfBuckets());
   CHECK_EQ(1, map->NumberOfElements());
   CHECK(OrderedHashMap::HasKey(isolate, *map, *key1));
 
   // Add existing key.
   map = OrderedHashMap::Add(isolate, map, key1, value1).ToHandleChecked();
   Verify(isolate, map);
-  CHECK_EQ(2, map->NumberOfBuckets());
+  CHECK_EQ(4, map->NumberOfBuckets());
   CHECK_EQ(1, map->NumberOfElements());
   CHECK(OrderedHashMap::HasKey(isolate, *map, *key1));
 
@@ -589,14 +590,14 @@ TEST(OrderedHashTableInsertion) {
   CHECK(!OrderedHashMap::HasKey(isolate, *map, *key2));
   map = OrderedHashMap::Add(isolate, map, key2, value).ToHandleChecked();
   Verify(isolate, map);
-  CHECK_EQ(2, map->NumberOfBuckets());
+  CHECK_EQ(4, map->NumberOfBuckets());
   CHECK_EQ(2, map->NumberOfElements());
   CHECK(OrderedHashMap::HasKey(isolate, *map, *key1));
   CHECK(OrderedHashMap::HasKey(isolate, *map, *key2));
 
   map = OrderedHashMap::Add(isolate, map, key2, value).ToHandleChecked();
   Verify(isolate, map);
-  CHECK_EQ(2, map->NumberOfBuckets());
+  CHECK_EQ(4, map->NumberOfBuckets());
   CHECK_EQ(2, map->NumberOfElements());
   CHECK(OrderedHashMap::HasKey(isolate, *map, *key1));
   CHECK(OrderedHashMap::HasKey(isolate, *map, *key2));
@@ -605,7 +606,7 @@ TEST(OrderedHashTableInsertion) {
   CHECK(!OrderedHashMap::HasKey(isolate, *map, *key3));
   map = OrderedHashMap::Add(isolate, map, key3, value).ToHandleChecked();
   Verify(isolate, map);
-  CHECK_EQ(2, map->NumberOfBuckets());
+  CHECK_EQ(4, map->NumberOfBuckets());
   CHECK_EQ(3, map->NumberOfElements());
   CHECK(OrderedHashMap::HasKey(isolate, *map, *key1));
   CHECK(OrderedHashMap::HasKey(isolate, *map, *key2));
@@ -613,7 +614,7 @@ TEST(OrderedHashTableInsertion) {
 
   map = OrderedHashMap::Add(isolate, map, key3, value).ToHandleChecked();
   Verify(isolate, map);
-  CHECK_EQ(2, map->NumberOfBuckets());
+  CHECK_EQ(4, map->NumberOfBuckets());
   CHECK_EQ(3, map->NumberOfElements());
   CHECK(OrderedHashMap::HasKey(isolate, *map, *key1));
   CHECK(OrderedHashMap::HasKey(isolate, *map, *key2));
@@ -623,7 +624,7 @@ TEST(OrderedHashTableInsertion) {
   CHECK(!OrderedHashMap::HasKey(isolate, *map, *key4));
   map = OrderedHashMap::Add(isolate, map, key4, value).ToHandleChecked();
   Verify(isolate, map);
-  CHECK_EQ(2, map->NumberOfBuckets());
+  CHECK_EQ(8, map->NumberOfBuckets());
   CHECK_EQ(4, map->NumberOfElements());
   CHECK(OrderedHashMap::HasKey(isolate, *map, *key1));
   CHECK(OrderedHashMap::HasKey(isolate, *map, *key2));
@@ -632,7 +633,7 @@ TEST(OrderedHashTableInsertion) {
 
   map = OrderedHashMap::Add(isolate, map, key4, value).ToHandleChecked();
   Verify(isolate, map);
-  CHECK_EQ(2, map->NumberOfBuckets());
+  CHECK_EQ(8, map->NumberOfBuckets());
   CHECK_EQ(4, map->NumberOfElements());
   CHECK(OrderedHashMap::HasKey(isolate, *map, *key1));
   CHECK(OrderedHashMap::HasKey(isolate, *map, *key2));
@@ -651,7 +652,7 @@ TEST(OrderedHashMapDuplicateHashCode) {
   Handle<JSObject> value = factory->NewJSObjectWithNullProto();
   map = OrderedHashMap::Add(isolate, map, key1, value).ToHandleChecked();
   Verify(isolate, map);
-  CHECK_EQ(2, map->NumberOfBuckets());
+  CHECK_EQ(4, map->NumberOfBuckets());
   CHECK_EQ(1, map->NumberOfElements());
   CHECK(OrderedHashMap::HasKey(isolate, *map, *key1));
 
@@ -660,12 +661,67 @@ TEST(OrderedHashMapDuplicateHashCode) {
 
   map = OrderedHashMap::Add(isolate, map, key2, value).ToHandleChecked();
   Verify(isolate, map);
-  CHECK_EQ(2, map->NumberOfBuckets());
+  CHECK_EQ(4, map->NumberOfBuckets());
   CHECK_EQ(2, map->NumberOfElements());
   CHECK(OrderedHashMap::HasKey(isolate, *map, *key1));
   CHECK(OrderedHashMap::HasKey(isolate, *map, *key2));
 }
 
+TEST(OrderedHashMapProbing) {
+  LocalContext context;
+  Isolate* isolate = GetIsolateFrom(&context);
+  Factory* factory = isolate->factory();
+  HandleScope scope(isolate);
+
+  // Keys with the same hash end up in consecutive buckets, and keys whose
+  // hashes select the last bucket wrap around to the first one.
+  const int kNumKeys = 64;
+  Handle<FixedArray> keys = factory->NewFixedArray(kNumKeys);
+  for (int i = 0; i < kNumKeys; i++) {
+    Handle<JSObject> key = factory->NewJSObjectWithNullProto();
+    key->SetIdentityHash(i < kNumKeys / 2 ? 7 : (i << 8) - 1);
+    keys->set(i, *key);
+  }
+
+  Handle<OrderedHashMap> map = factory->NewOrderedHashMap();
+  for (int i = 0; i < kNumKeys; i++) {
+    Handle<Object> key(keys->get(i), isolate);
+    map = OrderedHashMap::Add(isolate, map, key, key).ToHandleChecked();
+    Verify(isolate, map);
+    CHECK_EQ(i + 1, map->NumberOfElements());
+    CHECK_LE(map->NumberOfElements() * 4, map->NumberOfBuckets() * 3);
+  }
+  for (int i = 0; i < kNumKeys; i++) {
+    InternalIndex entry = map->FindEntry(isolate, keys->get(i));
+    CHECK(entry.is_found());
+    CHECK_EQ(i, entry.as_int());
+  }
+
+  // Deleted entries keep their buckets, so keys further along the probe
+  // sequence are still found.
+  for (int i = 0; i < kNumKeys; i++) {
+    if (i % 8 == 7) continue;
+    CHECK(OrderedHashMap::Delete(isolate, *map, keys->get(i)));
+  }
+  for (int i = 0; i < kNumKeys; i++) {
+    CHECK_EQ(i % 8 == 7, OrderedHashMap::HasKey(isolate, *map, keys->get(i)));
+  }
+
+  // Shrinking rehashes the table, which drops the deleted entries and
+  // preserves the insertion order.
+  int capacity = map->Capacity();
+  map = OrderedHashMap::Shrink(isolate, map);
+  Verify(isolate, map);
+  CHECK_EQ(capacity / 2, map->Capacity());
+  CHECK_EQ(kNumKeys / 8, map->NumberOfElements());
+  CHECK_EQ(0, map->NumberOfDeletedElements());
+  for (int i = 0; i < kNumKeys; i++) {
+    InternalIndex entry = map->FindEntry(isolate, keys->get(i));
+    CHECK_EQ(i % 8 == 7, entry.is_found());
+    if (entry.is_found()) CHECK_EQ(i / 8, entry.as_int());
+  }
+}
+
 TEST(OrderedHashMapDeletion) {
   LocalContext context;
   Isolate* isolate = GetIsolateFrom(&context);
@@ -676,7 +732,7 @@ TEST(OrderedHashMapDeletion) {
 
   Handle<OrderedHashMap> map = factory->NewOrderedHashMap();
   Verify(isolate, map);
-  CHECK_EQ(2, map->NumberOfBuckets());
+  CHECK_EQ(4, map->NumberOfBuckets());
   CHECK_EQ(0, map->NumberOfElements());
   CHECK_EQ(0, map->NumberOfDeletedElements());
 
@@ -684,14 +740,14 @@ TEST(OrderedHashMapDeletion) {
   Handle<Smi> key1(Smi::FromInt(1), isolate);
   CHECK(!OrderedHashMap::Delete(isolate, *map, *key1));
   Verify(isolate, map);
-  CHECK_EQ(2, map->NumberOfBuckets());
+  CHECK_EQ(4, map->NumberOfBuckets());
   CHECK_EQ(0, map->NumberOfElements());
   CHECK_EQ(0, map->NumberOfDeletedElements());
   CHECK(!OrderedHashMap::HasKey(isolate, *map, *key1));
 
   map = OrderedHashMap::Add(isolate, map, key1, value1).ToHandleChecked();
   Verify(isolate, map);
-  CHECK_EQ(2, map->NumberOfBuckets());
+  CHECK_EQ(4, map->NumberOfBuckets());
   CHECK_EQ(1, map->NumberOfElements());
   CHECK_EQ(0, map->NumberOfDeletedElements());
   CHECK(OrderedHashMap::HasKey(isolate, *map, *key1));
@@ -699,14 +755,14 @@ TEST(OrderedHashMapDeletion) {
   // Delete single existing key
   CHECK(OrderedHashMap::Delete(isolate, *map, *key1));
   Verify(isolate, map);
-  CHECK_EQ(2, map->NumberOfBuckets());
+  CHECK_EQ(4, map->NumberOfBuckets());
   CHECK_EQ(0, map->NumberOfElements());
   CHECK_EQ(1, map->NumberOfDeletedElements());
   CHECK(!OrderedHashMap::HasKey(isolate, *map, *key1));
 
   map = OrderedHashMap::Add(isolate, map, key1, value1).ToHandleChecked();
   Verify(isolate, map);
-  CHECK_EQ(2, map->NumberOfBuckets());
+  CHECK_EQ(4, map->NumberOfBuckets());
   CHECK_EQ(1, map->NumberOfElements());
   CHECK_EQ(1, map->NumberOfDeletedElements());
   CHECK(OrderedHashMap::HasKey(isolate, *map, *key1));
@@ -715,18 +771,19 @@ TEST(OrderedHashMapDeletion) {
   CHECK(!OrderedHashMap::HasKey(isolate, *map, *key2));
   map = OrderedHashMap::Add(isolate, map, key2, value).ToHandleChecked();
   Verify(isolate, map);
-  CHECK_EQ(2, map->NumberOfBuckets());
+  CHECK_EQ(4, map->NumberOfBuckets());
   CHECK_EQ(2, map->NumberOfElements());
   CHECK_EQ(1, map->NumberOfDeletedElements());
   CHECK(OrderedHashMap::HasKey(isolate, *map, *key2));
 
   Handle<Symbol> key3 = factory->NewSymbol();
   CHECK(!OrderedHashMap::HasKey(isolate, *map, *key3));
+  // The table is full, so adding the key drops the deleted entry.
   map = OrderedHashMap::Add(isolate, map, key3, value).ToHandleChecked();
   Verify(isolate, map);
-  CHECK_EQ(2, map->NumberOfBuckets());
+  CHECK_EQ(4, map->NumberOfBuckets());
   CHECK_EQ(3, map->NumberOfElements());
-  CHECK_EQ(1, map->NumberOfDeletedElements());
+  CHECK_EQ(0, map->NumberOfDeletedElements());
   CHECK(OrderedHashMap::HasKey(isolate, *map, *key1));
   CHECK(OrderedHashMap::HasKey(isolate, *map, *key2));
   CHECK(OrderedHashMap::HasKey(isolate, *map, *key3));
@@ -734,27 +791,27 @@ TEST(OrderedHashMapDeletion) {
   // Delete multiple existing keys
   CHECK(OrderedHashMap::Delete(isolate, *map, *key1));
   Verify(isolate, map);
-  CHECK_EQ(2, map->NumberOfBuckets());
+  CHECK_EQ(4, map->NumberOfBuckets());
   CHECK_EQ(2, map->NumberOfElements());
-  CHECK_EQ(2, map->NumberOfDeletedElements());
+  CHECK_EQ(1, map->NumberOfDeletedElements());
   CHECK(!OrderedHashMap::HasKey(isolate, *map, *key1));
   CHECK(OrderedHashMap::HasKey(isolate, *map, *key2));
   CHECK(OrderedHashMap::HasKey(isolate, *map, *key3));
 
   CHECK(OrderedHashMap::Delete(isolate, *map, *key2));
   Verify(isolate, map);
-  CHECK_EQ(2, map->NumberOfBuckets());
+  CHECK_EQ(4, map->NumberOfBuckets());
   CHECK_EQ(1, map->NumberOfElements());
-  CHECK_EQ(3, map->NumberOfDeletedElements());
+  CHECK_EQ(2, map->NumberOfDeletedElements());
   CHECK(!OrderedHashMap::HasKey(isolate, *map, *key1));
   CHECK(!OrderedHashMap::HasKey(isolate, *map, *key2));
   CHECK(OrderedHashMap::HasKey(isolate, *map, *key3));
 
   CHECK(OrderedHashMap::Delete(isolate, *map, *key3));
   Verify(isolate, map);
-  CHECK_EQ(2, map->NumberOfBuckets());
+  CHECK_EQ(4, map->NumberOfBuckets());
   CHECK_EQ(0, map->NumberOfElements());
-  CHECK_EQ(4, map->NumberOfDeletedElements());
+  CHECK_EQ(3, map->NumberOfDeletedElements());
   CHECK(!OrderedHashMap::HasKey(isolate, *map, *key1));
   CHECK(!OrderedHashMap::HasKey(isolate, *map, *key2));
   CHECK(!OrderedHashMap::HasKey(isolate, *map, *key3));
@@ -762,9 +819,9 @@ TEST(OrderedHashMapDeletion) {
   // Delete non existent key from non new hash table
   CHECK(!OrderedHashMap::Delete(isolate, *map, *key3));
   Verify(isolate, map);
-  CHECK_EQ(2, map->NumberOfBuckets());
+  CHECK_EQ(4, map->NumberOfBuckets());
   CHECK_EQ(0, map->NumberOfElements());
-  CHECK_EQ(4, map->NumberOfDeletedElements());
+  CHECK_EQ(3, map->NumberOfDeletedElements());
   CHECK(!OrderedHashMap::HasKey(isolate, *map, *key1));
   CHECK(!OrderedHashMap::HasKey(isolate, *map, *key2));
   CHECK(!OrderedHashMap::HasKey(isolate, *map, *key3));
@@ -773,7 +830,7 @@ TEST(OrderedHashMapDeletion) {
   map = OrderedHashMap::Shrink(isolate, map);
   map = OrderedHashMap::Add(isolate, map, key1, value).ToHandleChecked();
   Verify(isolate, map);
-  CHECK_EQ(2, map->NumberOfBuckets());
+  CHECK_EQ(4, map->NumberOfBuckets());
   CHECK_EQ(1, map->NumberOfElements());
   CHECK_EQ(0, map->NumberOfDeletedElements());
   CHECK(OrderedHashMap::HasKey(isolate, *map, *key1));
@@ -781,7 +838,7 @@ TEST(OrderedHashMapDeletion) {
   CHECK(!OrderedHashMap::HasKey(isolate, *map, *key3));
   CHECK(!OrderedHashMap::Delete(isolate, *map, *key2));
   Verify(isolate, map);
-  CHECK_EQ(2, map->NumberOfBuckets());
+  CHECK_EQ(4, map->NumberOfBuckets());
   CHECK_EQ(1, map->NumberOfElements());
   CHECK_EQ(0, map->NumberOfDeletedElements());
   CHECK(OrderedHashMap::HasKey(isolate, *map, *key1));
@@ -922,7 +979,7 @@ TEST(OrderedHashMapDuplicateHashCodeDeletion) {
   Handle<JSObject> value = factory->NewJSObjectWithNullProto();
   map = OrderedHashMap::Add(isolate, map, key1, value).ToHandleChecked();
   Verify(isolate, map);
-  CHECK_EQ(2, map->NumberOfBuckets());
+  CHECK_EQ(4, map->NumberOfBuckets());
   CHECK_EQ(1, map->NumberOfElements());
   CHECK_EQ(0, map->NumberOfDeletedElements());
   CHECK(OrderedHashMap::HasKey(isolate, *map, *key1));
@@ -933,7 +990,7 @@ TEST(OrderedHashMapDuplicateHashCodeDeletion) {
   // We shouldn't be able to delete the key!
   CHECK(!OrderedHashMap::Delete(isolate, *map, *key2));
   Verify(isolate, map);
-  CHECK_EQ(2, map->NumberOfBuckets());
+  CHECK_EQ(4, map->NumberOfBuckets());
   CHECK_EQ(1, map->NumberOfElements());
   CHECK_EQ(0, map->NumberOfDeletedElements());
   CHECK(OrderedHashMap::HasKey(isolate, *map, *key1));
@@ -977,7 +1034,7 @@ TEST(OrderedHashSetDeletion) {
 
   Handle<OrderedHashSet> set = factory->NewOrderedHashSet();
   Verify(isolate, set);
-  CHECK_EQ(2, set->NumberOfBuckets());
+  CHECK_EQ(4, set->NumberOfBuckets());
   CHECK_EQ(0, set->NumberOfElements());
   CHECK_EQ(0, set->NumberOfDeletedElements());
 
@@ -985,14 +1042,14 @@ TEST(OrderedHashSetDeletion) {
   Handle<Smi> key1(Smi::FromInt(1), isolate);
   CHECK(!OrderedHashSet::Delete(isolate, *set, *key1));
   Verify(isolate, set);
-  CHECK_EQ(2, set->NumberOfBuckets());
+  CHECK_EQ(4, set->NumberOfBuckets());
   CHECK_EQ(0, set->NumberOfElements());
   CHECK_EQ(0, set->NumberOfDeletedElements());
   CHECK(!OrderedHashSet::HasKey(isolate, *set, *key1));
 
   set = OrderedHashSet::Add(isolate, set, key1).ToHandleChecked();
   Verify(isolate, set);
-  CHECK_EQ(2, set->NumberOfBuckets());
+  CHECK_EQ(4, set->NumberOfBuckets());
   CHECK_EQ(1, set->NumberOfElements());
   CHECK_EQ(0, set->NumberOfDeletedElements());
   CHECK(OrderedHashSet::HasKey(isolate, *set, *key1));
@@ -1000,14 +1057,14 @@ TEST(OrderedHashSetDeletion) {
   // Delete single existing key
   CHECK(OrderedHashSet::Delete(isolate, *set, *key1));
   Verify(isolate, set);
-  CHECK_EQ(2, set->NumberOfBuckets());
+  CHECK_EQ(4, set->NumberOfBuckets());
   CHECK_EQ(0, set->NumberOfElements());
   CHECK_EQ(1, set->NumberOfDeletedElements());
   CHECK(!OrderedHashSet::HasKey(isolate, *set, *key1));
 
   set = OrderedHashSet::Add(isolate, set, key1).ToHandleChecked();
   Verify(isolate, set);
-  CHECK_EQ(2, set->NumberOfBuckets());
+  CHECK_EQ(4, set->NumberOfBuckets());
   CHECK_EQ(1, set->NumberOfElements());
   CHECK_EQ(1, set->NumberOfDeletedElements());
   CHECK(OrderedHashSet::HasKey(isolate, *set, *key1));
@@ -1016,18 +1073,19 @@ TEST(OrderedHashSetDeletion) {
   CHECK(!OrderedHashSet::HasKey(isolate, *set, *key2));
   set = OrderedHashSet::Add(isolate, set, key2).ToHandleChecked();
   Verify(isolate, set);
-  CHECK_EQ(2, set->NumberOfBuckets());
+  CHECK_EQ(4, set->NumberOfBuckets());
   CHECK_EQ(2, set->NumberOfElements());
   CHECK_EQ(1, set->NumberOfDeletedElements());
   CHECK(OrderedHashSet::HasKey(isolate, *set, *key2));
 
   Handle<Symbol> key3 = factory->NewSymbol();
   CHECK(!OrderedHashSet::HasKey(isolate, *set, *key3));
+  // The table is full, so adding the key drops the deleted entry.
   set = OrderedHashSet::Add(isolate, set, key3).ToHandleChecked();
   Verify(isolate, set);
-  CHECK_EQ(2, set->NumberOfBuckets());
+  CHECK_EQ(4, set->NumberOfBuckets());
   CHECK_EQ(3, set->NumberOfElements());
-  CHECK_EQ(1, set->NumberOfDeletedElements());
+  CHECK_EQ(0, set->NumberOfDeletedElements());
   CHECK(OrderedHashSet::HasKey(isolate, *set, *key1));
   CHECK(OrderedHashSet::HasKey(isolate, *set, *key2));
   CHECK(OrderedHashSet::HasKey(isolate, *set, *key3));
@@ -1035,27 +1093,27 @@ TEST(OrderedHashSetDeletion) {
   // Delete multiple existing keys
   CHECK(OrderedHashSet::Delete(isolate, *set, *key1));
   Verify(isolate, set);
-  CHECK_EQ(2, set->NumberOfBuckets());
+  CHECK_EQ(4, set->NumberOfBuckets());
   CHECK_EQ(2, set->NumberOfElements());
-  CHECK_EQ(2, set->NumberOfDeletedElements());
+  CHECK_EQ(1, set->NumberOfDeletedElements());
   CHECK(!OrderedHashSet::HasKey(isolate, *set, *key1));
   CHECK(OrderedHashSet::HasKey(isolate, *set, *key2));
   CHECK(OrderedHashSet::HasKey(isolate, *set, *key3));
 
   CHECK(OrderedHashSet::Delete(isolate, *set, *key2));
   Verify(isolate, set);
-  CHECK_EQ(2, set->NumberOfBuckets());
+  CHECK_EQ(4, set->NumberOfBuckets());
   CHECK_EQ(1, set->NumberOfElements());
-  CHECK_EQ(3, set->NumberOfDeletedElements());
+  CHECK_EQ(2, set->NumberOfDeletedElements());
   CHECK(!OrderedHashSet::HasKey(isolate, *set, *key1));
   CHECK(!OrderedHashSet::HasKey(isolate, *set, *key2));
   CHECK(OrderedHashSet::HasKey(isolate, *set, *key3));
 
   CHECK(OrderedHashSet::Delete(isolate, *set, *key3));
   Verify(isolate, set);
-  CHECK_EQ(2, set->NumberOfBuckets());
+  CHECK_EQ(4, set->NumberOfBuckets());
   CHECK_EQ(0, set->NumberOfElements());
-  CHECK_EQ(4, set->NumberOfDeletedElements());
+  CHECK_EQ(3, set->NumberOfDeletedElements());
   CHECK(!OrderedHashSet::HasKey(isolate, *set, *key1));
   CHECK(!OrderedHashSet::HasKey(isolate, *set, *key2));
   CHECK(!OrderedHashSet::HasKey(isolate, *set, *key3));
@@ -1063,9 +1121,9 @@ TEST(OrderedHashSetDeletion) {
   // Delete non existent key from non new hash table
   CHECK(!OrderedHashSet::Delete(isolate, *set, *key3));
   Verify(isolate, set);
-  CHECK_EQ(2, set->NumberOfBuckets());
+  CHECK_EQ(4, set->NumberOfBuckets());
   CHECK_EQ(0, set->NumberOfElements());
-  CHECK_EQ(4, set->NumberOfDeletedElements());
+  CHECK_EQ(3, set->NumberOfDeletedElements());
   CHECK(!OrderedHashSet::HasKey(isolate, *set, *key1));
   CHECK(!OrderedHashSet::HasKey(isolate, *set, *key2));
   CHECK(!OrderedHashSet::HasKey(isolate, *set, *key3));
@@ -1074,7 +1132,7 @@ TEST(OrderedHashSetDeletion) {
   set = OrderedHashSet::Shrink(isolate, set);
   set = OrderedHashSet::Add(isolate, set, key1).ToHandleChecked();
   Verify(isolate, set);
-  CHECK_EQ(2, set->NumberOfBuckets());
+  CHECK_EQ(4, set->NumberOfBuckets());
   CHECK_EQ(1, set->NumberOfElements());
   CHECK_EQ(0, set->NumberOfDeletedElements());
   CHECK(OrderedHashSet::HasKey(isolate, *set, *key1));
@@ -1082,7 +1140,7 @@ TEST(OrderedHashSetDeletion) {
   CHECK(!OrderedHashSet::HasKey(isolate, *set, *key3));
   CHECK(!OrderedHashSet::Delete(isolate, *set, *key2));
   Verify(isolate, set);
-  CHECK_EQ(2, set->NumberOfBuckets());
+  CHECK_EQ(4, set->NumberOfBuckets());
   CHECK_EQ(1, set->NumberOfElements());
   CHECK_EQ(0, set->NumberOfDeletedElements());
   CHECK(OrderedHashSet::HasKey(isolate, *set, *key1));
@@ -1220,7 +1278,7 @@ TEST(OrderedHashSetDuplicateHashCodeDeletion) {
   Handle<JSObject> key1 = factory->NewJSObjectWithNullProto();
   set = OrderedHashSet::Add(isolate, set, key1).ToHandleChecked();
   Verify(isolate, set);
-  CHECK_EQ(2, set->NumberOfBuckets());
+  CHECK_EQ(4, set->NumberOfBuckets());
   CHECK_EQ(1, set->NumberOfElements());
   CHECK_EQ(0, set->NumberOfDeletedElements());
   CHECK(OrderedHashSet::HasKey(isolate, *set, *key1));
@@ -1231,7 +1289,7 @@ TEST(OrderedHashSetDuplicateHashCodeDeletion) {
   // We shouldn't be able to delete the key!
   CHECK(!OrderedHashSet::Delete(isolate, *set, *key2));
   Verify(isolate, set);
-  CHECK_EQ(2, set->NumberOfBuckets());
+  CHECK_EQ(4, set->NumberOfBuckets());
   CHECK_EQ(1, set->NumberOfElements());
   CHECK_EQ(0, set->NumberOfDeletedElements());
   CHECK(OrderedHashSet::HasKey(isolate, *set, *key1));
@@ -1425,7 +1483,7 @@ TEST(OrderedNameDictionaryInsertion) {
   Handle<OrderedNameDictionary> dict =
       OrderedNameDictionary::Allocate(isolate, 2).ToHandleChecked();
   Verify(isolate, dict);
-  CHECK_EQ(2, dict->NumberOfBuckets());
+  CHECK_EQ(4, dict->NumberOfBuckets());
   CHECK_EQ(0, dict->NumberOfElements());
 
   Handle<String> key1 = isolate->factory()->InternalizeUtf8String("foo");
@@ -1435,7 +1493,7 @@ TEST(OrderedNameDictionaryInsertion) {
   dict = OrderedNameDictionary::Add(isolate, dict, key1, value, details)
              .ToHandleChecked();
   Verify(isolate, dict);
-  CHECK_EQ(2, dict->NumberOfBuckets());
+  CHECK_EQ(4, dict->NumberOfBuckets());
   CHECK_EQ(1, dict->NumberOfElements());
 
   CHECK_EQ(InternalIndex(0), dict->FindEntry(isolate, *key1));
@@ -1445,7 +1503,7 @@ TEST(OrderedNameDictionaryInsertion) {
   dict = OrderedNameDictionary::Add(isolate, dict, key2, value, details)
              .ToHandleChecked();
   Verify(isolate, dict);
-  CHECK_EQ(2, dict->NumberOfBuckets());
+  CHECK_EQ(4, dict->NumberOfBuckets());
   CHECK_EQ(2, dict->NumberOfElements());
   CHECK_EQ(InternalIndex(0), dict->FindEntry(isolate, *key1));
   CHECK_EQ(InternalIndex(1), dict->FindEntry(isolate, *key2));
@@ -1460,7 +1518,7 @@ TEST(OrderedNameDictionaryFindEntry) {
   Handle<OrderedNameDictionary> dict =
       OrderedNameDictionary::Allocate(isolate, 2).ToHandleChecked();
   Verify(isolate, dict);
-  CHECK_EQ(2, dict->NumberOfBuckets());
+  CHECK_EQ(4, dict->NumberOfBuckets());
   CHECK_EQ(0, dict->NumberOfElements());
 
   Handle<String> key1 = isolate->factory()->InternalizeUtf8String("foo");
@@ -1469,7 +1527,7 @@ TEST(OrderedNameDictionaryFindEntry) {
   dict = OrderedNameDictionary::Add(isolate, dict, key1, value, details)
              .ToHandleChecked();
   Verify(isolate, dict);
-  CHECK_EQ(2, dict->NumberOfBuckets());
+  CHECK_EQ(4, dict->NumberOfBuckets());
   CHECK_EQ(1, dict->NumberOfElements());
 
   InternalIndex entry = dict->FindEntry(isolate, *key1);
@@ -1480,7 +1538,7 @@ TEST(OrderedNameDictionaryFindEntry) {
   dict = OrderedNameDictionary::Add(isolate, dict, key2, value, details)
              .ToHandleChecked();
   Verify(isolate, dict);
-  CHECK_EQ(2, dict->NumberOfBuckets());
+  CHECK_EQ(4, dict->NumberOfBuckets());
   CHECK_EQ(2, dict->NumberOfElements());
 
   entry = dict->FindEntry(isolate, *key1);
@@ -1501,7 +1559,7 @@ TEST(OrderedNameDictionaryValueAtAndValueAtPut) {
   Handle<OrderedNameDictionary> dict =
       OrderedNameDictionary::Allocate(isolate, 2).ToHandleChecked();
   Verify(isolate, dict);
-  CHECK_EQ(2, dict->NumberOfBuckets());
+  CHECK_EQ(4, dict->NumberOfBuckets());
   CHECK_EQ(0, dict->NumberOfElements());
 
   Handle<String> key1 = isolate->factory()->InternalizeUtf8String("foo");
@@ -1511,7 +1569,7 @@ TEST(OrderedNameDictionaryValueAtAndValueAtPut) {
   dict = OrderedNameDictionary::Add(isolate, dict, key1, value, details)
              .ToHandleChecked();
   Verify(isolate, dict);
-  CHECK_EQ(2, dict->NumberOfBuckets());
+  CHECK_EQ(4, dict->NumberOfBuckets());
   CHECK_EQ(1, dict->NumberOfElements());
   CHECK_EQ(InternalIndex(0), dict->FindEntry(isolate, *key1));
 
@@ -1532,7 +1590,7 @@ TEST(OrderedNameDictionaryValueAtAndValueAtPut) {
   dict = OrderedNameDictionary::Add(isolate, dict, key2, value, details)
              .ToHandleChecked();
   Verify(isolate, dict);
-  CHECK_EQ(2, dict->NumberOfBuckets());
+  CHECK_EQ(4, dict->NumberOfBuckets());
   CHECK_EQ(2, dict->NumberOfElements());
   CHECK_EQ(InternalIndex(0), dict->FindEntry(isolate, *key1));
   CHECK_EQ(InternalIndex(1), dict->FindEntry(isolate, *key2));
@@ -1562,7 +1620,7 @@ TEST(OrderedNameDictionaryDetailsAtAndDetailsAtPut) {
   Handle<OrderedNameDictionary> dict =
       OrderedNameDictionary::Allocate(isolate, 2).ToHandleChecked();
   Verify(isolate, dict);
-  CHECK_EQ(2, dict->NumberOfBuckets());
+  CHECK_EQ(4, dict->NumberOfBuckets());
   CHECK_EQ(0, dict->NumberOfElements());
 
   Handle<String> key1 = isolate->factory()->InternalizeUtf8String("foo");
@@ -1572,7 +1630,7 @@ TEST(OrderedNameDictionaryDetailsAtAndDetailsAtPut) {
   dict = OrderedNameDictionary::Add(isolate, dict, key1, value, details)
              .ToHandleChecked();
   Verify(isolate, dict);
-  CHECK_EQ(2, dict->NumberOfBuckets());
+  CHECK_EQ(4, dict->NumberOfBuckets());
   CHECK_EQ(1, dict->NumberOfElements());
   CHECK_EQ(InternalIndex(0), dict->FindEntry(isolate, *key1));
 
@@ -1593,7 +1651,7 @@ TEST(OrderedNameDictionaryDetailsAtAndDetailsAtPut) {
   dict = OrderedNameDictionary::Add(isolate, dict, key2, value, details)
              .ToHandleChecked();
   Verify(isolate, dict);
-  CHECK_EQ(2, dict->NumberOfBuckets());
+  CHECK_EQ(4, dict->NumberOfBuckets());
   CHECK_EQ(2, dict->NumberOfElements());
   CHECK_EQ(InternalIndex(0), dict->FindEntry(isolate, *key1));
   CHECK_EQ(InternalIndex(1), dict->FindEntry(isolate, *key2));
@@ -1984,7 +2042,7 @@ TEST(OrderedNameDictionarySetEntry) {
   Handle<OrderedNameDictionary> dict =
       OrderedNameDictionary::Allocate(isolate, 2).ToHandleChecked();
   Verify(isolate, dict);
-  CHECK_EQ(2, dict->NumberOfBuckets());
+  CHECK_EQ(4, dict->NumberOfBuckets());
   CHECK_EQ(0, dict->NumberOfElements());
   CHECK_EQ(0, dict->NumberOfDeletedElements());
 
@@ -1995,7 +2053,7 @@ TEST(OrderedNameDictionarySetEntry) {
   dict = OrderedNameDictionary::Add(isolate, dict, key, value, details)
              .ToHandleChecked();
   Verify(isolate, dict);
-  CHECK_EQ(2, dict->NumberOfBuckets());
+  CHECK_EQ(4, dict->NumberOfBuckets());
   CHECK_EQ(1, dict->NumberOfElements());
 
   InternalIndex entry = dict->FindEntry(isolate, *key);
@@ -2072,7 +2130,7 @@ TEST(OrderedNameDictionaryDeleteEntry) {
   Handle<OrderedNameDictionary> dict =
       OrderedNameDictionary::Allocate(isolate, 2).ToHandleChecked();
   Verify(isolate, dict);
-  CHECK_EQ(2, dict->NumberOfBuckets());
+  CHECK_EQ(4, dict->NumberOfBuckets());
   CHECK_EQ(0, dict->NumberOfElements());
 
   Handle<String> key = factory->InternalizeUtf8String("foo");
@@ -2082,7 +2140,7 @@ TEST(OrderedNameDictionaryDeleteEntry) {
   dict = OrderedNameDictionary::Add(isolate, dict, key, value, details)
              .ToHandleChecked();
   Verify(isolate, dict);
-  CHECK_EQ(2, dict->NumberOfBuckets());
+  CHECK_EQ(4, dict->NumberOfBuckets());
   CHECK_EQ(1, dict->NumberOfElements());
   CHECK_EQ(0, dict->NumberOfDeletedElements());
 
@@ -32,6 +32,8 @@
 
 #include <stdlib.h>
 
+#include <set>
+
 #include "include/v8-json.h"
 #include "include/v8-template.h"
 #include "src/api/api-inl.h"
@@ -40,7 +42,9 @@
 #include "src/execution/messages.h"
 #include "src/heap/factory.h"
 #include "src/heap/heap-inl.h"
+#include "src/numbers/hash-seed-inl.h"
 #include "src/objects/objects-inl.h"
+#include "src/strings/string-hasher-inl.h"
 #include "test/cctest/cctest.h"
 #include "test/cctest/heap/heap-utils.h"
 
@@ -1524,6 +1528,69 @@ TEST(SliceFromSlice) {
   CHECK_EQ(0, strcmp("cdefghijklmnopqrstuvwx", string->ToCString().get()));
 }
 
+TEST(StringBuilderBackingStore) {
+  // Strings built in a loop by optimized code share an over-allocated
+  // sequential backing store. Check that the result is a slice of it with the
+  // expected length, that the backing store is at most twice as long, that
+  // the unused tail of the backing store is zeroed, and that appends reuse the
+  // backing store instead of copying the string every time.
+  if (!v8_flags.turbofan || !v8_flags.turboshaft ||
+      v8_flags.deopt_every_n_times > 0) {
+    return;
+  }
+  v8_flags.allow_natives_syntax = true;
+  v8_flags.turboshaft_string_builder = true;
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  const int kStartLength = 5;
+  const int kAppends = 9995;
+  const int kLength = kStartLength + kAppends;
+  v8::Local<v8::Value> result = CompileRun(
+      "function build(n) {"
+      "  let s = 'start';"
+      "  const parts = [];"
+      "  for (let i = 0; i < n; i++) {"
+      "    s += 'x';"
+      "    parts.push(s);"
+      "  }"
+      "  return parts;"
+      "}"
+      "%PrepareFunctionForOptimization(build);"
+      "build(10);"
+      "%OptimizeFunctionOnNextCall(build);"
+      "build(9995);");
+  CHECK(CompileRun("%ActiveTierIsTurbofan(build)")->IsTrue());
+  CHECK(result->IsArray());
+  DirectHandle<JSArray> parts =
+      v8::Utils::OpenDirectHandle(v8::Array::Cast(*result));
+
+  DisallowGarbageCollection no_gc;
+  Tagged<FixedArray> elements = FixedArray::cast(parts->elements());
+  std::set<Address> backing_stores;
+  for (int i = 0; i < kAppends; i++) {
+    Tagged<String> part = String::cast(elements->get(i));
+    CHECK_EQ(kStartLength + i + 1, part->length());
+    if (part->length() < SlicedString::kMinLength) continue;
+    CHECK(IsSlicedString(part));
+    backing_stores.insert(SlicedString::cast(part)->parent().ptr());
+  }
+  // A new backing store is only allocated once the current one is full, and
+  // is then twice as long as needed, so there is about one per doubling.
+  CHECK_LE(backing_stores.size(), 16u);
+
+  Tagged<String> string = String::cast(elements->get(kAppends - 1));
+  CHECK_EQ(kLength, string->length());
+  Tagged<String> parent = SlicedString::cast(string)->parent();
+  CHECK(IsSeqOneByteString(parent));
+  Tagged<SeqOneByteString> backing_store = SeqOneByteString::cast(parent);
+  CHECK_LE(backing_store->length(), 2 * kLength);
+  CHECK_LE(backing_store->AllocatedSize(),
+           SeqOneByteString::SizeFor(2 * kLength));
+  for (int i = kLength; i < backing_store->length(); i++) {
+    CHECK_EQ(0, backing_store->Get(i));
+  }
+}
+
 UNINITIALIZED_TEST(OneByteArrayJoin) {
   v8::Isolate::CreateParams create_params;
   // Set heap limits.
@@ -1874,6 +1941,39 @@ TEST(HashArrayIndexStrings) {
   }
 }
 
+TEST(HashIndependentOfRepresentation) {
+  // The hash consumes several characters at a time. It must not depend on
+  // whether they are stored as one-byte or two-byte characters, nor on how
+  // the string length is split into words and tail.
+  const uint64_t seed = HashSeed(CcTest::i_isolate());
+  uint8_t one_byte[64];
+  uint16_t two_byte[64];
+  for (int i = 0; i < 64; i++) {
+    one_byte[i] = static_cast<uint8_t>(i % 3 == 0 ? 0xE0 + i : 'a' + i % 26);
+    two_byte[i] = one_byte[i];
+  }
+  std::set<uint32_t> hashes;
+  for (int length = 0; length <= 64; length++) {
+    uint32_t hash = StringHasher::HashSequentialString(one_byte, length, seed);
+    CHECK_EQ(hash, StringHasher::HashSequentialString(two_byte, length, seed));
+    CHECK(String::IsHash(hash));
+    CHECK_NE(0u, Name::HashBits::decode(hash));
+    // Prefixes of the same string all hash differently.
+    CHECK(hashes.insert(hash).second);
+  }
+
+  // Changing any single character changes the hash.
+  for (int length = 1; length <= 24; length++) {
+    uint32_t hash = StringHasher::HashSequentialString(one_byte, length, seed);
+    for (int i = 0; i < length; i++) {
+      two_byte[i] = 0x100 + one_byte[i];
+      CHECK_NE(hash,
+               StringHasher::HashSequentialString(two_byte, length, seed));
+      two_byte[i] = one_byte[i];
+    }
+  }
+}
+
 TEST(StringEquals) {
   v8::Isolate* isolate = CcTest::isolate();
   v8::HandleScope scope(isolate);
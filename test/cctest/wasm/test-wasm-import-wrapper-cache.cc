@@ -115,6 +115,45 @@ TEST(CacheMissKind) {
   CHECK_NULL(c2);
 }
 
+TEST(CacheMissSuspend) {
+  Isolate* isolate = CcTest::InitIsolateOnce();
+  auto module = NewModule(isolate);
+  TestSignatures sigs;
+  WasmCodeRefScope wasm_code_ref_scope;
+  WasmImportWrapperCache::ModificationScope cache_scope(
+      module->import_wrapper_cache());
+
+  auto kind = ImportCallKind::kJSFunctionArityMatch;
+  auto sig = sigs.i_i();
+  int expected_arity = static_cast<int>(sig->parameter_count());
+  uint32_t canonical_type_index =
+      GetTypeCanonicalizer()->AddRecursiveGroup(sig);
+
+  WasmCode* c1 = CompileImportWrapper(module.get(), isolate->counters(), kind,
+                                      sig, canonical_type_index, expected_arity,
+                                      kNoSuspend, &cache_scope);
+
+  CHECK_NOT_NULL(c1);
+  CHECK_EQ(WasmCode::Kind::kWasmToJsWrapper, c1->kind());
+
+  WasmCode* c2 =
+      cache_scope[{kind, canonical_type_index, expected_arity, kSuspend}];
+
+  CHECK_NULL(c2);
+
+  // Keys that only differ in their suspend mode don't share a hash.
+  WasmImportWrapperCache::CacheKeyHash hash;
+  size_t no_suspend_hash =
+      hash({kind, canonical_type_index, expected_arity, kNoSuspend});
+  size_t suspend_hash =
+      hash({kind, canonical_type_index, expected_arity, kSuspend});
+  size_t suspend_with_suspender_hash = hash(
+      {kind, canonical_type_index, expected_arity, kSuspendWithSuspender});
+  CHECK_NE(no_suspend_hash, suspend_hash);
+  CHECK_NE(no_suspend_hash, suspend_with_suspender_hash);
+  CHECK_NE(suspend_hash, suspend_with_suspender_hash);
+}
+
 TEST(CacheHitMissSig) {
   Isolate* isolate = CcTest::InitIsolateOnce();
   auto module = NewModule(isolate);
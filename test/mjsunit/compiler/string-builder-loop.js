@@ -0,0 +1,134 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turboshaft-string-builder
+
+function expected(start, parts, n) {
+  let result = start;
+  for (let i = 0; i < n; i++) {
+    for (let part of parts) result = result.concat(part);
+  }
+  return result;
+}
+
+(function OneByte() {
+  function build(start, n) {
+    let s = start;
+    for (let i = 0; i < n; i++) {
+      s += "<td>";
+      s += i;
+    }
+    return s;
+  }
+
+  %PrepareFunctionForOptimization(build);
+  assertEquals("x<td>0<td>1", build("x", 2));
+  %OptimizeFunctionOnNextCall(build);
+  for (let n of [0, 1, 3, 20, 1000]) {
+    let result = build("abc", n);
+    let expected = "abc";
+    for (let i = 0; i < n; i++) expected += "<td>" + i;
+    assertEquals(expected, result);
+  }
+})();
+
+(function TwoByte() {
+  function build(start, part, n) {
+    let s = start;
+    for (let i = 0; i < n; i++) {
+      s += part;
+    }
+    return s;
+  }
+
+  %PrepareFunctionForOptimization(build);
+  assertEquals("abab", build("", "ab", 2));
+  %OptimizeFunctionOnNextCall(build);
+  // One-byte builders that switch to two-byte characters half-way.
+  let s = build("", "abcdefgh", 10);
+  assertEquals(expected("", ["abcdefgh"], 10), s);
+  assertEquals(expected(s, ["ሴbc"], 50), build(s, "ሴbc", 50));
+  assertEquals(expected("é", ["xy"], 100), build("é", "xy", 100));
+  assertEquals(expected("☃", ["é☃"], 100),
+               build("☃", "é☃", 100));
+})();
+
+(function SlicedStartValue() {
+  function build(start, n) {
+    let s = start;
+    for (let i = 0; i < n; i++) s += "-";
+    return s;
+  }
+
+  %PrepareFunctionForOptimization(build);
+  build("a", 2);
+  %OptimizeFunctionOnNextCall(build);
+  // {start} is a SlicedString at offset 0 of a string that is longer than
+  // {start}, so appending to it in place would overwrite {long_string}.
+  let long_string = "0123456789abcdefghijklmnopqrstuvwxyz".repeat(2);
+  let start = long_string.substring(0, 20);
+  assertEquals(start + "-----", build(start, 5));
+  assertEquals("0123456789abcdefghijklmnopqrstuvwxyz".repeat(2), long_string);
+  // The same start value can be used several times.
+  assertEquals(start + "--", build(start, 2));
+  assertEquals(start + "---", build(start, 3));
+  assertEquals(start, long_string.substring(0, 20));
+})();
+
+(function EscapingIntermediateValues() {
+  function build(start, n, out) {
+    let s = start;
+    for (let i = 0; i < n; i++) {
+      s += "abcdefghijklmnopq";
+      out.push(s);
+      s += i;
+    }
+    return s;
+  }
+
+  %PrepareFunctionForOptimization(build);
+  build("", 2, []);
+  %OptimizeFunctionOnNextCall(build);
+  let out = [];
+  let result = build("", 30, out);
+  let s = "";
+  for (let i = 0; i < 30; i++) {
+    s += "abcdefghijklmnopq";
+    assertEquals(s, out[i]);
+    s += i;
+  }
+  assertEquals(s, result);
+  // Appending to an intermediate value must not change later ones.
+  for (let i = 0; i < 30; i++) {
+    assertEquals(out[i] + "abcdefghijklmnopq0", build(out[i], 1, []));
+  }
+  s = "";
+  for (let i = 0; i < 30; i++) {
+    s += "abcdefghijklmnopq";
+    assertEquals(s, out[i]);
+    s += i;
+  }
+})();
+
+(function Deopt() {
+  function build(start, parts) {
+    let s = start;
+    for (let i = 0; i < parts.length; i++) {
+      s += parts[i];
+    }
+    return s;
+  }
+
+  let parts = [];
+  for (let i = 0; i < 100; i++) parts.push("part" + i + ";");
+  %PrepareFunctionForOptimization(build);
+  build("", parts);
+  %OptimizeFunctionOnNextCall(build);
+  assertEquals(parts.join(""), build("", parts));
+  // Deoptimize in the middle of the loop and keep appending in the
+  // interpreter.
+  let mixed = parts.slice();
+  mixed[50] = {toString() { return "object;"; }};
+  assertEquals(mixed.join(""), build("", mixed));
+})();
@@ -0,0 +1,66 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Test lookups of interesting symbols (like @@toStringTag) on dictionary mode
+// objects and prototype chains.
+
+function SlowObject() {
+  const o = {a: 1, b: 2, c: 3};
+  delete o.a;
+  assertFalse(%HasFastProperties(o));
+  return o;
+}
+
+(function TestWithoutInterestingProperty() {
+  const o = SlowObject();
+  assertEquals("[object Object]", Object.prototype.toString.call(o));
+  assertEquals("[object Object]", String(o));
+})();
+
+(function TestOwnToStringTag() {
+  const o = SlowObject();
+  o[Symbol.toStringTag] = "Slow";
+  assertEquals("[object Slow]", Object.prototype.toString.call(o));
+  delete o[Symbol.toStringTag];
+  assertEquals("[object Object]", Object.prototype.toString.call(o));
+})();
+
+(function TestInheritedToStringTag() {
+  const proto = SlowObject();
+  proto[Symbol.toStringTag] = "Proto";
+  const o = Object.create(proto);
+  o.x = 1;
+  delete o.x;
+  assertEquals("[object Proto]", Object.prototype.toString.call(o));
+  const p = Object.create(o);
+  assertEquals("[object Proto]", Object.prototype.toString.call(p));
+})();
+
+(function TestDictionaryPrototypeChain() {
+  const proto = SlowObject();
+  const o = SlowObject();
+  Object.setPrototypeOf(o, proto);
+  assertEquals("[object Object]", Object.prototype.toString.call(o));
+  assertEquals("[object Object]", `${o}`);
+})();
+
+(function TestToPrimitive() {
+  const o = SlowObject();
+  o[Symbol.toPrimitive] = () => 42;
+  assertEquals(43, o + 1);
+  delete o[Symbol.toPrimitive];
+  assertEquals("[object Object]1", o + 1);
+})();
+
+(function TestOtherInterestingPropertyOnHolder() {
+  const proto = SlowObject();
+  proto[Symbol.toStringTag] = "Proto";
+  const o = SlowObject();
+  o[Symbol.toPrimitive] = () => 42;
+  Object.setPrototypeOf(o, proto);
+  assertEquals("[object Proto]", Object.prototype.toString.call(o));
+  assertEquals(43, o + 1);
+})();
@@ -0,0 +1,55 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Exercises strings, whitespace runs and digit runs that span several vector
+// widths, with the interesting character at every possible position.
+
+function testString(filler) {
+  for (let length = 0; length < 70; length++) {
+    const body = filler.repeat(length);
+    assertEquals(body, JSON.parse(`"${body}"`));
+    assertEquals(body + '"', JSON.parse(`"${body}\\""`));
+    assertEquals(body + '\\x', JSON.parse(`"${body}\\\\x"`));
+    assertEquals(body + '☃' + body,
+                 JSON.parse(`"${body}\\u2603${body}"`));
+    assertThrows(() => JSON.parse(`"${body}\n"`), SyntaxError);
+    assertThrows(() => JSON.parse(`"${body}\x1f"`), SyntaxError);
+    assertThrows(() => JSON.parse(`"${body}`), SyntaxError);
+  }
+}
+
+testString('a');
+testString('\xe9');
+testString('☃');
+
+// Non-Latin1 characters after a long Latin1 prefix.
+for (let length = 0; length < 70; length++) {
+  const prefix = 'x'.repeat(length);
+  const value = JSON.parse(`["${prefix}", "${prefix}Ā"]`);
+  assertEquals(prefix, value[0]);
+  assertEquals(prefix + 'Ā', value[1]);
+}
+
+// Characters above 0xFF whose low byte looks like a terminator must not end
+// the string.
+assertEquals('aĢbŜcād'.repeat(10),
+             JSON.parse(`"${'aĢbŜcād'.repeat(10)}"`));
+
+for (let length = 0; length < 70; length++) {
+  for (const ws of [' ', '\t', '\n', '\r', ' \r\n\t']) {
+    const padding = ws.repeat(length);
+    assertEquals([1, 'a', {b: null}],
+                 JSON.parse(`${padding}[${padding}1${padding},${padding}"a"` +
+                            `${padding},${padding}{${padding}"b"${padding}:` +
+                            `${padding}null${padding}}${padding}]${padding}`));
+  }
+  const digits = '1'.repeat(length + 1);
+  assertEquals(Number(digits), JSON.parse(digits));
+  assertEquals(Number(`${digits}.${digits}`),
+               JSON.parse(`${digits}.${digits}`));
+  assertEquals(Number(`-${digits}e${length % 3}`),
+               JSON.parse(`-${digits}e${length % 3}`));
+  assertThrows(() => JSON.parse(`${digits}.`), SyntaxError);
+  assertThrows(() => JSON.parse(`${digits}١`), SyntaxError);
+}
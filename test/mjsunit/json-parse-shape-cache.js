@@ -0,0 +1,43 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --expose-gc
+
+// Objects of the same shape from separate parses share their map.
+const a = JSON.parse('{"id": 1, "name": "a", "nested": {"x": 1, "y": 2}}');
+const b = JSON.parse('{"id": 2, "name": "b", "nested": {"x": 3, "y": 4}}');
+assertTrue(%HaveSameMap(a, b));
+assertTrue(%HaveSameMap(a.nested, b.nested));
+
+// Keys with the same lengths and first characters map to the same cache entry,
+// but must still produce objects with the right keys.
+const c = JSON.parse('{"ab": 1, "cd": 2}');
+const d = JSON.parse('{"ax": 3, "cy": 4}');
+assertEquals(['ab', 'cd'], Object.keys(c));
+assertEquals(['ax', 'cy'], Object.keys(d));
+assertEquals(4, d.cy);
+assertFalse(%HaveSameMap(c, d));
+
+// Fewer or more keys than the cached shape.
+assertEquals({ab: 1}, JSON.parse('{"ab": 1}'));
+assertEquals({ab: 1, cd: 2, ef: 3}, JSON.parse('{"ab": 1, "cd": 2, "ef": 3}'));
+
+// Field representations are generalized as usual.
+const e = JSON.parse('{"ab": 1.5, "cd": "x"}');
+assertEquals({ab: 1.5, cd: 'x'}, e);
+assertEquals({ab: 1, cd: 2}, JSON.parse('{"ab": 1, "cd": 2}'));
+
+// Objects with elements.
+assertEquals({0: 'z', ab: 1, cd: 2},
+             JSON.parse('{"ab": 1, "0": "z", "cd": 2}'));
+
+// Cached maps are dropped on GC and are not used across native contexts.
+gc();
+assertEquals({ab: 7, cd: 8}, JSON.parse('{"ab": 7, "cd": 8}'));
+const realm = Realm.create();
+const other = Realm.eval(realm, 'JSON.parse(\'{"ab": 1, "cd": 2}\')');
+assertNotSame(Object.prototype, Object.getPrototypeOf(other));
+assertSame(Realm.eval(realm, 'Object.prototype'), Object.getPrototypeOf(other));
+const mine = JSON.parse('{"ab": 1, "cd": 2}');
+assertSame(Object.prototype, Object.getPrototypeOf(mine));
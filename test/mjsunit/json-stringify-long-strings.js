@@ -0,0 +1,52 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Characters that need escaping at every position of strings spanning several
+// vector widths.
+function testEscapes(filler) {
+  for (let length = 0; length < 70; length++) {
+    const body = filler.repeat(length);
+    for (const [c, escaped] of [['"', '\\"'], ['\\', '\\\\'], ['\n', '\\n'],
+                                ['\x01', '\\u0001'], ['\ud800', '\\ud800'],
+                                ['\udfff', '\\udfff'],
+                                ['😀', '😀']]) {
+      assertEquals(`"${body}${escaped}${body}"`,
+                   JSON.stringify(body + c + body));
+    }
+  }
+}
+
+testEscapes('a');
+testEscapes('\xe9');
+testEscapes('☃');
+
+// Characters above 0xFF whose low byte needs escaping are copied as-is.
+const lowBytesNeedEscaping = 'aĢbŜcā'.repeat(10);
+assertEquals(`"${lowBytesNeedEscaping}"`,
+             JSON.stringify(lowBytesNeedEscaping));
+
+// Strings longer than the internal chunk size, with surrogate pairs and
+// escapes at and around every chunk boundary.
+for (const prefix of ['', 'x', 'xx', '☃']) {
+  const pair = '😀';
+  const long = prefix + (pair + 'ab"cd\\ef\n').repeat(20000);
+  const expected = '"' + prefix +
+      (pair + 'ab\\"cd\\\\ef\\n').repeat(20000) + '"';
+  assertEquals(expected, JSON.stringify(long));
+  assertEquals(long, JSON.parse(JSON.stringify(long)));
+  assertEquals(`{"a":${expected},"b":[${expected}]}`,
+               JSON.stringify({a: long, b: [long]}));
+}
+
+// Long strings without any escapes, one-byte and two-byte.
+for (const c of ['a', '☃']) {
+  const long = c.repeat(100000);
+  assertEquals(`"${long}"`, JSON.stringify(long));
+}
+
+// Raw JSON is copied verbatim.
+if (typeof JSON.rawJSON === 'function') {
+  const raw = '"' + 'a'.repeat(50000) + '"';
+  assertEquals(`[${raw}]`, JSON.stringify([JSON.rawJSON(raw)]));
+}
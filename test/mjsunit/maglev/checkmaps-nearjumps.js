@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 // Flags: --maglev --allow-natives-syntax --max-valid-polymorphic-map-count=100
+// Flags: --max-valid-polymorphic-named-map-count=100
 
 // Test based on regress-crbug-1445286.js; this will generate a lot of maps
 // which are passed to CheckMaps.
@@ -0,0 +1,45 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --turbofan
+// Flags: --max-valid-polymorphic-named-map-count=12
+
+// Records with 10 different shapes, each with {id} at a different offset.
+function makeRecord(shape, id) {
+  const record = {};
+  for (let i = 0; i < shape; i++) record['prefix' + i] = i;
+  record.id = id;
+  return record;
+}
+const records = [];
+for (let shape = 0; shape < 10; shape++) records.push(makeRecord(shape, shape));
+
+function getId(record) {
+  return record.id;
+}
+
+function sumIds() {
+  let sum = 0;
+  for (const record of records) sum += getId(record);
+  return sum;
+}
+
+%PrepareFunctionForOptimization(getId);
+assertEquals(45, sumIds());
+assertEquals(45, sumIds());
+
+// The load stays polymorphic, so both tiers can dispatch on the maps and
+// don't need to deoptimize for any of the known shapes.
+%OptimizeMaglevOnNextCall(getId);
+assertEquals(45, sumIds());
+assertOptimized(getId);
+
+%PrepareFunctionForOptimization(getId);
+%OptimizeFunctionOnNextCall(getId);
+assertEquals(45, sumIds());
+assertOptimized(getId);
+
+// An unknown shape still deoptimizes.
+assertEquals(42, getId(makeRecord(11, 42)));
+assertUnoptimized(getId);
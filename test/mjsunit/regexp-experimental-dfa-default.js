@@ -0,0 +1,26 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --no-force-slow-path
+// Flags: --default-to-experimental-regexp-engine-with-dfa
+
+// Patterns the lazy DFA supports run on the experimental engine without the
+// 'l' flag.
+assertEquals("EXPERIMENTAL", %RegexpTypeTag(/123|asdf/));
+assertEquals("EXPERIMENTAL", %RegexpTypeTag(/(a|b)+c/g));
+assertEquals("EXPERIMENTAL", %RegexpTypeTag(/(x+x+)+y/));
+
+// Atoms keep their own engine.
+assertEquals("ATOM", %RegexpTypeTag(/asdf/));
+
+// Assertions and back references are not supported by the DFA or the
+// experimental engine.
+assertEquals("IRREGEXP", %RegexpTypeTag(/^(a|b)+$/));
+assertEquals("IRREGEXP", %RegexpTypeTag(/\bfoo/));
+assertEquals("IRREGEXP", %RegexpTypeTag(/(a*)\1/));
+
+// Results don't change.
+assertEquals(["abac", "a"], /(a|b)+c/.exec("xxabac"));
+assertEquals(["abc", "bc"], "abcxbc".match(/(a|b)+c/g));
+assertEquals(null, /(x+x+)+y/.exec("x".repeat(10000)));
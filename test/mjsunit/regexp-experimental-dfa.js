@@ -0,0 +1,40 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --enable-experimental-regexp-engine
+// Flags: --regexp-lazy-dfa
+
+// Compares the linear engine, which rules out matches with a lazy DFA, against
+// irregexp.
+function Test(source, flags, subjects) {
+  const linear = new RegExp(source, flags + 'l');
+  assertEquals('EXPERIMENTAL', %RegexpTypeTag(linear));
+  const backtracking = new RegExp(source, flags);
+  for (const subject of subjects) {
+    linear.lastIndex = 0;
+    backtracking.lastIndex = 0;
+    assertEquals(backtracking.exec(subject), linear.exec(subject));
+    assertEquals(backtracking.lastIndex, linear.lastIndex);
+    assertEquals(subject.match(backtracking), subject.match(linear));
+    assertEquals(subject.replace(backtracking, '<$&>'),
+                 subject.replace(linear, '<$&>'));
+  }
+}
+
+const kLong = 'x'.repeat(10000);
+
+Test('(a|b)+c', '', ['xxabac', 'xxabax', 'c', 'abéc', kLong + 'abc']);
+Test('(a|b)+c', 'g', ['abcabcxbc', 'ac bc ' + kLong, kLong]);
+Test('(a|b)+c', 'y', ['abc', 'xabc']);
+Test('[一-鿿]+', 'g', ['abc中文def字', kLong + '中']);
+Test('(?:a?)*b', 'g', ['aab', 'aaaa', 'b', '']);
+Test('(x+x+)+y', '', [kLong, kLong + 'y']);
+Test('', 'g', ['', 'abc']);
+Test('a|', 'g', ['bab']);
+Test('(?:ab){2,3}?', 'g', ['abababab', 'aba' + kLong]);
+Test('.+z', 's', ['a\nz', kLong]);
+
+// Assertions are not supported by the DFA and have to run on the NFA alone.
+Test('^(a|b)+$', 'm', ['ab\nba', 'abc']);
+Test('\\bfoo\\b', 'g', ['foo food foo']);
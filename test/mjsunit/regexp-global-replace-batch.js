@@ -0,0 +1,57 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Global replacements collect their matches in batches. Test match counts
+// around and across batch boundaries.
+
+function ReplaceByHand(subject, regexp, replacement) {
+  let result = '';
+  let last = 0;
+  const re = new RegExp(regexp.source, regexp.flags.replace('g', '') + 'y');
+  for (let i = 0; i <= subject.length; i++) {
+    re.lastIndex = i;
+    const match = re.exec(subject);
+    if (match === null) continue;
+    result += subject.substring(last, i) + replacement;
+    last = i + match[0].length;
+    i = Math.max(i, last - 1);
+    if (match[0].length == 0 && i + 1 < subject.length &&
+        regexp.unicode && subject.codePointAt(i) > 0xFFFF) {
+      i++;
+    }
+  }
+  return result + subject.substring(last);
+}
+
+for (const count of [1, 63, 64, 65, 511, 512, 513, 1500, 5000]) {
+  const subject = 'ab1 '.repeat(count);
+  for (const regexp of [/b\d/g, /(b)(\d)/g, /\s*/g, /1 /g, /1 a/g]) {
+    const expected = ReplaceByHand(subject, regexp, '-');
+    assertEquals(expected, subject.replace(regexp, '-'));
+    assertEquals(expected, subject.replaceAll(regexp, '-'));
+    assertEquals(0, regexp.lastIndex);
+  }
+  assertEquals('ab'.repeat(count), subject.replace(/\d /g, ''));
+  assertEquals(count, subject.match(/b\d/g).length);
+}
+
+// The last match info reflects the last match.
+'x1y2z3'.repeat(1000).replace(/([a-z])(\d)/g, '');
+assertEquals('z3', RegExp.lastMatch);
+assertEquals('z', RegExp.$1);
+assertEquals('3', RegExp.$2);
+
+// Non-global replacements only replace the first match.
+assertEquals('a-b1', 'ab1b1'.replace(/b\d/, '-'));
+assertEquals('ab1b1', 'ab1b1'.replace(/c/, '-'));
+const sticky = /b\d/y;
+sticky.lastIndex = 3;
+assertEquals('ab1-', 'ab1b1'.replace(sticky, '-'));
+assertEquals(5, sticky.lastIndex);
+
+// Zero-length matches advance by code points in unicode mode.
+assertEquals('-\u{1F600}-\u{1F600}-',
+             '\u{1F600}\u{1F600}'.replace(/(?:)/gu, '-'));
+assertEquals(ReplaceByHand('\u{1F600}'.repeat(600), /(?:)/gu, '-'),
+             '\u{1F600}'.repeat(600).replace(/(?:)/gu, '-'));
@@ -0,0 +1,58 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-prefilter --js-regexp-modifiers
+
+// Compares regexps that skip ahead to their literal prefix against equivalent
+// regexps whose prefix cannot be determined since it is hidden in a
+// disjunction.
+function Test(source, flags, subjects) {
+  const prefiltered = new RegExp(source, flags);
+  const reference = new RegExp(`(?:${source}|[^\\s\\S])`, flags);
+  for (const subject of subjects) {
+    for (let i = 0; i <= subject.length; i += 7) {
+      prefiltered.lastIndex = i;
+      reference.lastIndex = i;
+      assertEquals(reference.exec(subject), prefiltered.exec(subject));
+      assertEquals(reference.lastIndex, prefiltered.lastIndex);
+    }
+    assertEquals(subject.match(reference), subject.match(prefiltered));
+    assertEquals(subject.replace(reference, '<$&>'),
+                 subject.replace(prefiltered, '<$&>'));
+    assertEquals(subject.split(reference), subject.split(prefiltered));
+    const global_flags = flags.includes('g') ? flags : flags + 'g';
+    assertEquals(
+        [...subject.matchAll(new RegExp(reference, global_flags))],
+        [...subject.matchAll(new RegExp(prefiltered, global_flags))]);
+  }
+}
+
+const kLong = 'x'.repeat(10000);
+const kLog = 'GET /index.html 200\nPOST /api/v1 500\n'.repeat(100) +
+             'ERROR: disk full (code 28)\n' + kLong;
+
+Test('ERROR: (\\w+) (\\w+)', '', [kLog, kLong, 'ERROR: a']);
+Test('ERROR: (\\w+) (\\w+)', 'g', [kLog, kLog + kLog, '']);
+Test('POST (/\\w+)+', 'g', [kLog]);
+Test('foo\\d+', 'g', ['foo foo1 foo22 fo3', kLong + 'foo42' + kLong]);
+Test('(?:abc)+x', 'g', ['abcabcx abx abcx', kLong + 'abcabcabcx']);
+Test('(abc){2}', '', ['abcabd abcabc']);
+Test('abc(?=d)', 'g', ['abce abcd', kLong + 'abcd']);
+Test('abc(?!d)', 'g', ['abcd abce']);
+Test('\\babc\\b', 'g', ['xabc abc abcx abc']);
+Test('(?<=a)bcd', 'g', ['bcd abcd xbcd', kLong + 'abcd']);
+Test('(?<!a)bcd', 'g', ['abcd xbcd bcd']);
+Test('abc$', 'gm', ['abc\nabcd\nxabc', kLong + 'abc']);
+Test('abc', 'y', ['abc', 'xabc']);
+Test('abc', 'i', ['ABC', 'xAbC']);
+Test('(?i:abc)def', 'g', ['ABCdef abcDEF aBcdef']);
+Test('^abc', '', ['abc', 'xabc']);
+
+// Two-byte subjects and patterns.
+Test('中文\\w', 'g', ['中文a 中文', kLong + '中文b']);
+Test('abc', 'g', ['中abc文abc']);
+Test('ab\u{1F600}c', 'gu',
+     ['ab\u{1F600}c ab\u{1F601}c', kLong + 'ab\u{1F600}c']);
+Test('\u{1F600}abc', 'gu', ['\u{1F600}abc \u{1F600}ab']);
+Test('\\ud83dabc', 'g', ['\ud83dabc \u{1F600}abc']);
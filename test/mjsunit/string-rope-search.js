@@ -0,0 +1,88 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Long ropes are searched and compared leaf by leaf instead of being
+// flattened. Test matches within leaves and across leaf boundaries.
+
+function MakeRope(pieces) {
+  let rope = '';
+  for (const piece of pieces) rope += piece;
+  return rope;
+}
+
+const pieces = [];
+for (let i = 0; i < 300; i++) {
+  pieces.push('ab'.repeat(i % 5) + 'c' + String.fromCharCode(0x61 + i % 7));
+}
+const twoBytePieces = pieces.slice();
+twoBytePieces[150] += '☃';
+
+for (const p of [pieces, twoBytePieces]) {
+  const flat = %FlattenString(MakeRope(p));
+  const rope = MakeRope(p);
+  assertTrue(rope.length >= 1024);
+  for (const length of [1, 2, 3, 5, 8, 13, 40]) {
+    for (let position = 0; position + length <= flat.length; position += 37) {
+      const search = flat.substring(position, position + length);
+      for (const start of [0, position, position + 1, flat.length - length]) {
+        assertEquals(flat.indexOf(search, start), rope.indexOf(search, start));
+        assertEquals(flat.includes(search, start),
+                     rope.includes(search, start));
+      }
+    }
+  }
+  assertEquals(flat.indexOf('abababababc'), rope.indexOf('abababababc'));
+  assertEquals(-1, rope.indexOf('☄'));
+  assertEquals(flat.indexOf('☃c'), rope.indexOf('☃c'));
+  assertEquals(flat.indexOf('ga☃'), rope.indexOf('ga☃'));
+}
+
+// Relational comparison and equality of ropes.
+{
+  const different = pieces.slice();
+  different[200] = different[200].replace('c', 'd');
+  const shorter = pieces.slice(0, 299);
+  assertTrue(MakeRope(pieces) < MakeRope(different));
+  assertFalse(MakeRope(different) < MakeRope(pieces));
+  assertTrue(MakeRope(shorter) < MakeRope(pieces));
+  assertTrue(MakeRope(pieces) <= MakeRope(pieces));
+  assertFalse(MakeRope(pieces) < MakeRope(pieces));
+  assertTrue(MakeRope(pieces) == MakeRope(pieces));
+  assertFalse(MakeRope(pieces) == MakeRope(different));
+  assertTrue(MakeRope(twoBytePieces) > MakeRope(pieces));
+}
+
+// Deep left-leaning ropes, as built by appending to a string in a loop, are
+// traversed in linear time.
+{
+  const kSteps = 100000;
+  function MakeDeepRope() {
+    let rope = '';
+    for (let i = 0; i < kSteps; i++) rope += String.fromCharCode(0x61 + i % 26);
+    return rope;
+  }
+  // Optimized code may build the string in place instead of as a rope.
+  %NeverOptimizeFunction(MakeDeepRope);
+  const flat = %FlattenString(MakeDeepRope());
+  const lastAlphabet = Math.floor((kSteps - 26) / 26) * 26;
+  assertEquals(lastAlphabet,
+               MakeDeepRope().indexOf('abcdefghijklmnopqrstuvwxyz',
+                                      lastAlphabet - 1));
+  assertEquals(-1, MakeDeepRope().indexOf('za'.repeat(2)));
+  assertFalse(MakeDeepRope().includes('aa'));
+  assertEquals(26 * 2, MakeDeepRope().indexOf('a', 27));
+  assertTrue(MakeDeepRope() == MakeDeepRope());
+  assertTrue(MakeDeepRope() == flat);
+  assertFalse(MakeDeepRope() < MakeDeepRope());
+  assertTrue(MakeDeepRope() < flat + 'a');
+  assertTrue(MakeDeepRope().slice(0, -1) + '~' > MakeDeepRope());
+
+  // Searching a rope to the end flattens it, so repeated searches don't
+  // traverse it again.
+  const rope = MakeDeepRope();
+  for (let i = 0; i < 1000; i++) assertEquals(-1, rope.indexOf('zz'));
+  assertEquals(flat, rope);
+}
@@ -61,3 +61,39 @@ function GlobalImportedInitTest(pad) {
 GlobalImportedInitTest(0);
 GlobalImportedInitTest(1);
 GlobalImportedInitTest(4);
+
+function LargeDataSegmentsTest(overlap) {
+  print("LargeDataSegmentsTest(" + overlap + ")...");
+  // Large segments are copied in parallel, unless they overlap.
+  const kSegmentSize = 768 * 1024;
+  var builder = new WasmModuleBuilder();
+  builder.addImportedMemory("mod", "memory", 32, 32);
+  var first = new Array(kSegmentSize).fill(1);
+  var second = new Array(kSegmentSize);
+  for (var i = 0; i < kSegmentSize; ++i) second[i] = i & 0xff;
+  var second_offset = overlap ? kSegmentSize / 2 : kSegmentSize;
+  builder.addActiveDataSegment(0, wasmI32Const(0), first);
+  builder.addActiveDataSegment(0, wasmI32Const(second_offset), second);
+  // The last segment is out of bounds, but the preceding segments are still
+  // copied.
+  builder.addActiveDataSegment(0, wasmI32Const(32 * kPageSize - 2), [7, 7, 7]);
+
+  var memory = new WebAssembly.Memory({initial: 32, maximum: 32});
+  var module = new WebAssembly.Module(builder.toBuffer(debug));
+  assertThrows(() => new WebAssembly.Instance(module, {mod: {memory}}),
+               WebAssembly.RuntimeError);
+  var view = new Uint8Array(memory.buffer);
+  for (var i = 0; i < second_offset; ++i) {
+    if (view[i] != 1) assertEquals(1, view[i]);
+  }
+  for (var i = 0; i < kSegmentSize; ++i) {
+    if (view[second_offset + i] != (i & 0xff)) {
+      assertEquals(i & 0xff, view[second_offset + i]);
+    }
+  }
+  assertEquals(0, view[second_offset + kSegmentSize]);
+  assertEquals(0, view[32 * kPageSize - 2]);
+}
+
+LargeDataSegmentsTest(false);
+LargeDataSegmentsTest(true);
@@ -0,0 +1,85 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --wasm-memory64-trap-handling --experimental-wasm-memory64
+// Flags: --turboshaft-wasm --allow-natives-syntax
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+// A maximum of 3GB results in 8GB of guard regions, which allows Turboshaft to
+// skip the guard region check for zero-extended 32-bit indices.
+const kMaxPages = 3 * 1024 * 1024 * 1024 / kPageSize;
+
+(function testZeroExtendedIndex() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  const memory = builder.addMemory64(1, kMaxPages);
+
+  builder.addFunction('load', kSig_i_i).addBody([
+    kExprLocalGet, 0,
+    kExprI64UConvertI32,
+    kExprI32LoadMem, 0x40, memory, 0
+  ]).exportFunc();
+
+  builder.addFunction('load_offset', kSig_i_i).addBody([
+    kExprLocalGet, 0,
+    kExprI64UConvertI32,
+    // Offset 0x7fffffff (LEB128).
+    kExprI32LoadMem, 0x40, memory, 0xff, 0xff, 0xff, 0xff, 0x07
+  ]).exportFunc();
+
+  builder.addFunction('store', kSig_v_ii).addBody([
+    kExprLocalGet, 0,
+    kExprI64UConvertI32,
+    kExprLocalGet, 1,
+    kExprI32StoreMem, 0x40, memory, 0
+  ]).exportFunc();
+
+  const {load, load_offset, store} = builder.instantiate().exports;
+  %WasmTierUpFunction(load);
+  %WasmTierUpFunction(load_offset);
+  %WasmTierUpFunction(store);
+
+  store(kPageSize - 4, 0x12345678);
+  assertEquals(0x12345678, load(kPageSize - 4));
+  assertTraps(kTrapMemOutOfBounds, () => load(kPageSize - 2));
+  assertTraps(kTrapMemOutOfBounds, () => load(kPageSize));
+  assertTraps(kTrapMemOutOfBounds, () => load(-1));
+  assertTraps(kTrapMemOutOfBounds, () => load_offset(0));
+  assertTraps(kTrapMemOutOfBounds, () => load_offset(-1));
+  assertTraps(kTrapMemOutOfBounds, () => store(kPageSize, 0));
+  assertTraps(kTrapMemOutOfBounds, () => store(-1, 0));
+  assertEquals(0x12345678, load(kPageSize - 4));
+})();
+
+(function testConstantIndex() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  const memory = builder.addMemory64(1, 1);
+
+  builder.addFunction('load_in_bounds', kSig_i_v).addBody([
+    ...wasmI64Const(kPageSize - 4),
+    kExprI32LoadMem, 0x40, memory, 0
+  ]).exportFunc();
+
+  builder.addFunction('load_in_guards', kSig_i_v).addBody([
+    ...wasmI64Const(kPageSize),
+    kExprI32LoadMem, 0x40, memory, 0
+  ]).exportFunc();
+
+  builder.addFunction('load_huge', kSig_i_v).addBody([
+    ...wasmI64Const(2 ** 50),
+    kExprI32LoadMem, 0x40, memory, 0
+  ]).exportFunc();
+
+  const {load_in_bounds, load_in_guards, load_huge} =
+      builder.instantiate().exports;
+  %WasmTierUpFunction(load_in_bounds);
+  %WasmTierUpFunction(load_in_guards);
+  %WasmTierUpFunction(load_huge);
+
+  assertEquals(0, load_in_bounds());
+  assertTraps(kTrapMemOutOfBounds, load_in_guards);
+  assertTraps(kTrapMemOutOfBounds, load_huge);
+})();
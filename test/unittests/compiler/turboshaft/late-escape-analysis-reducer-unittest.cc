@@ -0,0 +1,139 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/turboshaft/late-escape-analysis-reducer.h"
+
+#include "src/compiler/turboshaft/assembler.h"
+#include "src/compiler/turboshaft/copying-phase.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "test/unittests/compiler/turboshaft/reducer-test.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+#include "src/compiler/turboshaft/define-assembler-macros.inc"
+
+class LateEscapeAnalysisReducerTest : public ReducerTest {
+ public:
+  static const ReturnOp* GetReturn(TestInstance& test) {
+    for (const Operation& op : test.graph().AllOperations()) {
+      if (const ReturnOp* ret = op.TryCast<ReturnOp>()) return ret;
+    }
+    UNREACHABLE();
+  }
+};
+
+TEST_F(LateEscapeAnalysisReducerTest, RemoveStoreOnlyAllocation) {
+  auto test = CreateFromGraph(1, [](auto& Asm) {
+    Uninitialized<HeapObject> uninitialized =
+        __ template Allocate<HeapObject>(__ IntPtrConstant(16),
+                                         AllocationType::kYoung);
+    V<HeapObject> alloc = __ FinishInitialization(std::move(uninitialized));
+    __ Store(alloc, Asm.GetParameter(0), StoreOp::Kind::TaggedBase(),
+             MemoryRepresentation::AnyTagged(),
+             WriteBarrierKind::kNoWriteBarrier, 8);
+    __ Return(Asm.GetParameter(0));
+  });
+
+  test.Run<LateEscapeAnalysisReducer>();
+
+  ASSERT_EQ(test.CountOp(Opcode::kAllocate), 0u);
+  ASSERT_EQ(test.CountOp(Opcode::kStore), 0u);
+}
+
+TEST_F(LateEscapeAnalysisReducerTest, ReplaceLoadFromInitializedField) {
+  auto test = CreateFromGraph(1, [](auto& Asm) {
+    Uninitialized<HeapObject> uninitialized =
+        __ template Allocate<HeapObject>(__ IntPtrConstant(16),
+                                         AllocationType::kYoung);
+    V<HeapObject> alloc = __ FinishInitialization(std::move(uninitialized));
+    __ Store(alloc, Asm.GetParameter(0), StoreOp::Kind::TaggedBase(),
+             MemoryRepresentation::AnyTagged(),
+             WriteBarrierKind::kNoWriteBarrier, 8);
+    V<Object> load = __ Load(alloc, {}, LoadOp::Kind::TaggedBase(),
+                             MemoryRepresentation::AnyTagged(),
+                             RegisterRepresentation::Tagged(), 8);
+    __ Return(load);
+  });
+
+  test.Run<LateEscapeAnalysisReducer>();
+
+  ASSERT_EQ(test.CountOp(Opcode::kAllocate), 0u);
+  ASSERT_EQ(test.CountOp(Opcode::kStore), 0u);
+  ASSERT_EQ(test.CountOp(Opcode::kLoad), 0u);
+  const ReturnOp* ret = GetReturn(test);
+  ASSERT_TRUE(test.graph().Get(ret->return_values()[0]).Is<ParameterOp>());
+}
+
+TEST_F(LateEscapeAnalysisReducerTest, KeepAllocationForLoadBeforeStore) {
+  auto test = CreateFromGraph(1, [](auto& Asm) {
+    Uninitialized<HeapObject> uninitialized =
+        __ template Allocate<HeapObject>(__ IntPtrConstant(16),
+                                         AllocationType::kYoung);
+    V<HeapObject> alloc = __ FinishInitialization(std::move(uninitialized));
+    V<Object> load = __ Load(alloc, {}, LoadOp::Kind::TaggedBase(),
+                             MemoryRepresentation::AnyTagged(),
+                             RegisterRepresentation::Tagged(), 8);
+    __ Store(alloc, Asm.GetParameter(0), StoreOp::Kind::TaggedBase(),
+             MemoryRepresentation::AnyTagged(),
+             WriteBarrierKind::kNoWriteBarrier, 8);
+    __ Return(load);
+  });
+
+  test.Run<LateEscapeAnalysisReducer>();
+
+  ASSERT_EQ(test.CountOp(Opcode::kAllocate), 1u);
+  ASSERT_EQ(test.CountOp(Opcode::kLoad), 1u);
+}
+
+TEST_F(LateEscapeAnalysisReducerTest, KeepAllocationForOverwrittenField) {
+  auto test = CreateFromGraph(2, [](auto& Asm) {
+    Uninitialized<HeapObject> uninitialized =
+        __ template Allocate<HeapObject>(__ IntPtrConstant(16),
+                                         AllocationType::kYoung);
+    V<HeapObject> alloc = __ FinishInitialization(std::move(uninitialized));
+    __ Store(alloc, Asm.GetParameter(0), StoreOp::Kind::TaggedBase(),
+             MemoryRepresentation::AnyTagged(),
+             WriteBarrierKind::kNoWriteBarrier, 8);
+    __ Store(alloc, Asm.GetParameter(1), StoreOp::Kind::TaggedBase(),
+             MemoryRepresentation::AnyTagged(),
+             WriteBarrierKind::kNoWriteBarrier, 8);
+    V<Object> load = __ Load(alloc, {}, LoadOp::Kind::TaggedBase(),
+                             MemoryRepresentation::AnyTagged(),
+                             RegisterRepresentation::Tagged(), 8);
+    __ Return(load);
+  });
+
+  test.Run<LateEscapeAnalysisReducer>();
+
+  ASSERT_EQ(test.CountOp(Opcode::kAllocate), 1u);
+  ASSERT_EQ(test.CountOp(Opcode::kLoad), 1u);
+}
+
+TEST_F(LateEscapeAnalysisReducerTest, KeepAllocationForEscapingUse) {
+  auto test = CreateFromGraph(1, [](auto& Asm) {
+    Uninitialized<HeapObject> uninitialized =
+        __ template Allocate<HeapObject>(__ IntPtrConstant(16),
+                                         AllocationType::kYoung);
+    V<HeapObject> alloc = __ FinishInitialization(std::move(uninitialized));
+    __ Store(alloc, Asm.GetParameter(0), StoreOp::Kind::TaggedBase(),
+             MemoryRepresentation::AnyTagged(),
+             WriteBarrierKind::kNoWriteBarrier, 8);
+    V<Object> load = __ Load(alloc, {}, LoadOp::Kind::TaggedBase(),
+                             MemoryRepresentation::AnyTagged(),
+                             RegisterRepresentation::Tagged(), 8);
+    __ Store(Asm.GetParameter(0), alloc, StoreOp::Kind::TaggedBase(),
+             MemoryRepresentation::AnyTagged(),
+             WriteBarrierKind::kFullWriteBarrier, 8);
+    __ Return(load);
+  });
+
+  test.Run<LateEscapeAnalysisReducer>();
+
+  ASSERT_EQ(test.CountOp(Opcode::kAllocate), 1u);
+  ASSERT_EQ(test.CountOp(Opcode::kLoad), 1u);
+}
+
+#include "src/compiler/turboshaft/undef-assembler-macros.inc"
+
+}  // namespace v8::internal::compiler::turboshaft
@@ -0,0 +1,115 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/turboshaft/string-builder-reducer.h"
+
+#include "src/compiler/turboshaft/assembler.h"
+#include "test/unittests/compiler/turboshaft/reducer-test.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+#include "src/compiler/turboshaft/define-assembler-macros.inc"
+
+class StringBuilderAnalyzerTest : public ReducerTest {};
+
+namespace {
+
+base::SmallVector<OpIndex, 4> GetStringConcats(const Graph& graph) {
+  base::SmallVector<OpIndex, 4> concats;
+  for (OpIndex index : graph.AllOperationIndices()) {
+    if (graph.Get(index).Is<StringConcatOp>()) concats.push_back(index);
+  }
+  return concats;
+}
+
+}  // namespace
+
+// for (i = 0; i < 10; i++) s = s + x + y;
+TEST_F(StringBuilderAnalyzerTest, AppendInLoop) {
+  OpIndex start;
+  auto test = CreateFromGraph(3, [&start](auto& Asm) {
+    using AssemblerT = std::remove_reference<decltype(Asm)>::type::Assembler;
+    start = Asm.GetParameter(0);
+    ScopedVariable<String, AssemblerT> s(&Asm, V<String>::Cast(start));
+    ScopedVariable<Word32, AssemblerT> i(&Asm, 0);
+
+    WHILE(__ Int32LessThan(i, 10)) {
+      s = __ StringConcat(s, V<String>::Cast(Asm.GetParameter(1)));
+      s = __ StringConcat(s, V<String>::Cast(Asm.GetParameter(2)));
+      i = __ Word32Add(i, 1);
+    }
+
+    __ Return(s);
+  });
+
+  StringBuilderAnalyzer analyzer(test.graph(), test.zone());
+  analyzer.Run();
+
+  auto concats = GetStringConcats(test.graph());
+  ASSERT_EQ(2u, concats.size());
+  for (OpIndex concat : concats) {
+    EXPECT_EQ(start, analyzer.GetStringBuilderStart(concat));
+  }
+}
+
+// for (i = 0; i < 10; i++) s = x + s;
+TEST_F(StringBuilderAnalyzerTest, PrependInLoop) {
+  auto test = CreateFromGraph(2, [](auto& Asm) {
+    using AssemblerT = std::remove_reference<decltype(Asm)>::type::Assembler;
+    ScopedVariable<String, AssemblerT> s(&Asm,
+                                         V<String>::Cast(Asm.GetParameter(0)));
+    ScopedVariable<Word32, AssemblerT> i(&Asm, 0);
+
+    WHILE(__ Int32LessThan(i, 10)) {
+      s = __ StringConcat(V<String>::Cast(Asm.GetParameter(1)), s);
+      i = __ Word32Add(i, 1);
+    }
+
+    __ Return(s);
+  });
+
+  StringBuilderAnalyzer analyzer(test.graph(), test.zone());
+  analyzer.Run();
+
+  auto concats = GetStringConcats(test.graph());
+  ASSERT_EQ(1u, concats.size());
+  EXPECT_FALSE(analyzer.GetStringBuilderStart(concats[0]).valid());
+}
+
+// for (i = 0; i < 10; i++) for (j = 0; j < 10; j++) s = s + x;
+//
+// The inner loop is a string builder of its own, but its start value is the
+// phi of the outer loop, so it would copy the whole string once per iteration
+// of the outer loop. The outer loop cannot append in place either, because the
+// concatenation runs several times per iteration.
+TEST_F(StringBuilderAnalyzerTest, AppendInNestedLoop) {
+  auto test = CreateFromGraph(2, [](auto& Asm) {
+    using AssemblerT = std::remove_reference<decltype(Asm)>::type::Assembler;
+    ScopedVariable<String, AssemblerT> s(&Asm,
+                                         V<String>::Cast(Asm.GetParameter(0)));
+    ScopedVariable<Word32, AssemblerT> i(&Asm, 0);
+
+    WHILE(__ Int32LessThan(i, 10)) {
+      ScopedVariable<Word32, AssemblerT> j(&Asm, 0);
+      WHILE(__ Int32LessThan(j, 10)) {
+        s = __ StringConcat(s, V<String>::Cast(Asm.GetParameter(1)));
+        j = __ Word32Add(j, 1);
+      }
+      i = __ Word32Add(i, 1);
+    }
+
+    __ Return(s);
+  });
+
+  StringBuilderAnalyzer analyzer(test.graph(), test.zone());
+  analyzer.Run();
+
+  auto concats = GetStringConcats(test.graph());
+  ASSERT_EQ(1u, concats.size());
+  EXPECT_FALSE(analyzer.GetStringBuilderStart(concats[0]).valid());
+}
+
+#include "src/compiler/turboshaft/undef-assembler-macros.inc"
+
+}  // namespace v8::internal::compiler::turboshaft
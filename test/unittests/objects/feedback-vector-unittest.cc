@@ -2,11 +2,14 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <string>
+
 #include "src/api/api-inl.h"
 #include "src/execution/execution.h"
 #include "src/heap/factory.h"
 #include "src/objects/feedback-cell-inl.h"
 #include "src/objects/objects-inl.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/test-utils.h"
 
 namespace v8 {
@@ -478,6 +481,18 @@ TEST_F(FeedbackVectorTest, VectorLoadICStates) {
   nexus.ExtractMaps(&maps);
   CHECK_EQ(4, maps.size());
 
+  // Named accesses stay polymorphic for more maps than element accesses.
+  for (int i = 4; i < v8_flags.max_valid_polymorphic_named_map_count; i++) {
+    std::string source = "f({ foo: 2, p" + std::to_string(i) + ": 0 })";
+    TryRunJS(source.c_str());
+    CHECK_EQ(InlineCacheState::POLYMORPHIC, nexus.ic_state());
+  }
+  maps.clear();
+  nexus.ExtractMaps(&maps);
+  CHECK_EQ(
+      static_cast<size_t>(v8_flags.max_valid_polymorphic_named_map_count),
+      maps.size());
+
   // Finally driven megamorphic.
   TryRunJS("f({ blarg: 3, gran: 3, torino: 10, foo: 2 })");
   CHECK_EQ(InlineCacheState::MEGAMORPHIC, nexus.ic_state());
@@ -488,6 +503,38 @@ TEST_F(FeedbackVectorTest, VectorLoadICStates) {
   CHECK_EQ(InlineCacheState::MEGAMORPHIC, nexus.ic_state());
 }
 
+TEST_F(FeedbackVectorTest, VectorLoadICFollowsPolymorphicMapCount) {
+  if (!i::v8_flags.use_ic) return;
+  if (i::v8_flags.always_turbofan) return;
+  v8_flags.allow_natives_syntax = true;
+  // Raising the limit for all accesses also raises it for named accesses.
+  FLAG_VALUE_SCOPE(max_valid_polymorphic_named_map_count, 2);
+  FLAG_VALUE_SCOPE(max_valid_polymorphic_map_count, 8);
+
+  v8::HandleScope scope(v8_isolate());
+  Isolate* isolate = i_isolate();
+
+  TryRunJS(
+      "%EnsureFeedbackVectorForFunction(f);"
+      "function f(a) { return a.foo; }");
+  Handle<JSFunction> f = GetFunction("f");
+  Handle<FeedbackVector> feedback_vector =
+      Handle<FeedbackVector>(f->feedback_vector(), isolate);
+  FeedbackNexus nexus(feedback_vector, FeedbackSlot(0));
+
+  for (int i = 0; i < 8; i++) {
+    std::string source = "f({ foo: 2, p" + std::to_string(i) + ": 0 })";
+    TryRunJS(source.c_str());
+  }
+  CHECK_EQ(InlineCacheState::POLYMORPHIC, nexus.ic_state());
+  MapHandles maps;
+  nexus.ExtractMaps(&maps);
+  CHECK_EQ(8, maps.size());
+
+  TryRunJS("f({ foo: 2, p8: 0 })");
+  CHECK_EQ(InlineCacheState::MEGAMORPHIC, nexus.ic_state());
+}
+
 TEST_F(FeedbackVectorTest, VectorLoadGlobalICSlotSharing) {
   if (!i::v8_flags.use_ic) return;
   if (i::v8_flags.always_turbofan) return;
@@ -15,10 +15,12 @@
 #include "src/ast/ast.h"
 #include "src/base/strings.h"
 #include "src/codegen/assembler-arch.h"
+#include "src/codegen/compilation-cache.h"
 #include "src/codegen/macro-assembler.h"
 #include "src/init/v8.h"
 #include "src/objects/js-regexp-inl.h"
 #include "src/objects/objects-inl.h"
+#include "src/regexp/regexp-bytecode-cache.h"
 #include "src/regexp/regexp-bytecode-generator.h"
 #include "src/regexp/regexp-bytecodes.h"
 #include "src/regexp/regexp-compiler.h"
@@ -650,7 +652,7 @@ static Handle<JSRegExp> CreateJSRegExp(Handle<String> source, Handle<Code> code,
       Handle<JSRegExp>::cast(factory->NewJSObject(constructor));
 
   factory->SetRegExpIrregexpData(regexp, source, {}, 0,
-                                 JSRegExp::kNoBacktrackLimit);
+                                 JSRegExp::kNoBacktrackLimit, {});
   const bool is_latin1 = !is_unicode;
   regexp->set_code(is_latin1, code);
 
@@ -1754,11 +1756,11 @@ void CreatePeepholeNoChangeBytecode(RegExpMacroAssembler* m) {
   m->PushBacktrack(&fail);
   m->CheckNotAtStart(0, nullptr);
   m->LoadCurrentCharacter(2, nullptr);
-  m->CheckNotCharacter('o', nullptr);
+  m->CheckNotCharacterAfterAnd('o', 0xFF, nullptr);
   m->LoadCurrentCharacter(1, nullptr, false);
-  m->CheckNotCharacter('o', nullptr);
+  m->CheckNotCharacterAfterAnd('o', 0xFF, nullptr);
   m->LoadCurrentCharacter(0, nullptr, false);
-  m->CheckNotCharacter('f', nullptr);
+  m->CheckNotCharacterAfterAnd('f', 0xFF, nullptr);
   m->WriteCurrentPositionToRegister(0, 0);
   m->WriteCurrentPositionToRegister(1, 3);
   m->AdvanceCurrentPosition(3);
@@ -1842,6 +1844,71 @@ TEST_F(RegExpTest, PeepholeSkipUntilChar) {
            array_optimized->get(RegExpBytecodeLength(BC_SKIP_UNTIL_CHAR)));
 }
 
+void CreatePeepholeCheckNotCharAtBytecode(RegExpMacroAssembler* m) {
+  Label fail;
+  m->LoadCurrentCharacter(0, &fail);
+  m->CheckNotCharacter('f', &fail);
+  m->LoadCurrentCharacter(1, nullptr, false);
+  m->CheckNotCharacter('o', &fail);
+  m->Succeed();
+  m->Bind(&fail);
+  m->Fail();
+}
+
+TEST_F(RegExpTest, PeepholeCheckNotCharAt) {
+  Zone zone(i_isolate()->allocator(), ZONE_NAME);
+  Factory* factory = i_isolate()->factory();
+  HandleScope scope(i_isolate());
+
+  RegExpBytecodeGenerator orig(i_isolate(), &zone);
+  RegExpBytecodeGenerator opt(i_isolate(), &zone);
+
+  CreatePeepholeCheckNotCharAtBytecode(&orig);
+  CreatePeepholeCheckNotCharAtBytecode(&opt);
+
+  Handle<String> source = factory->NewStringFromStaticChars("fo");
+
+  v8_flags.regexp_peephole_optimization = false;
+  Handle<ByteArray> array = Handle<ByteArray>::cast(orig.GetCode(source));
+  int length = array->length();
+
+  v8_flags.regexp_peephole_optimization = true;
+  Handle<ByteArray> array_optimized =
+      Handle<ByteArray>::cast(opt.GetCode(source));
+  int length_optimized = array_optimized->length();
+
+  int length_expected = RegExpBytecodeLength(BC_LOAD_CURRENT_CHAR) +
+                        RegExpBytecodeLength(BC_CHECK_NOT_CHAR) +
+                        RegExpBytecodeLength(BC_LOAD_CURRENT_CHAR_UNCHECKED) +
+                        RegExpBytecodeLength(BC_CHECK_NOT_CHAR) +
+                        RegExpBytecodeLength(BC_SUCCEED) +
+                        RegExpBytecodeLength(BC_FAIL) +
+                        RegExpBytecodeLength(BC_POP_BT);
+  int length_optimized_expected =
+      RegExpBytecodeLength(BC_CHECK_NOT_CHAR_AT) +
+      RegExpBytecodeLength(BC_CHECK_NOT_CHAR_AT_UNCHECKED) +
+      RegExpBytecodeLength(BC_SUCCEED) + RegExpBytecodeLength(BC_FAIL) +
+      RegExpBytecodeLength(BC_POP_BT);
+
+  CHECK_EQ(length, length_expected);
+  CHECK_EQ(length_optimized, length_optimized_expected);
+
+  CHECK_EQ(BC_CHECK_NOT_CHAR_AT, array_optimized->get(0));
+  int pc = RegExpBytecodeLength(BC_CHECK_NOT_CHAR_AT);
+  CHECK_EQ(BC_CHECK_NOT_CHAR_AT_UNCHECKED, array_optimized->get(pc));
+  pc += RegExpBytecodeLength(BC_CHECK_NOT_CHAR_AT_UNCHECKED);
+  CHECK_EQ(BC_SUCCEED, array_optimized->get(pc));
+  pc += RegExpBytecodeLength(BC_SUCCEED);
+  CHECK_EQ(BC_FAIL, array_optimized->get(pc));
+
+  // Both failure jumps point to the FAIL bytecode.
+  int fail_pc = pc;
+  CHECK_EQ(fail_pc, array_optimized->get_int(8));
+  CHECK_EQ(fail_pc, array_optimized->get_int(12));
+  CHECK_EQ(fail_pc, array_optimized->get_int(
+                        RegExpBytecodeLength(BC_CHECK_NOT_CHAR_AT) + 8));
+}
+
 void CreatePeepholeSkipUntilBitInTableBytecode(RegExpMacroAssembler* m,
                                                Factory* factory) {
   Handle<ByteArray> bit_table = factory->NewByteArray(
@@ -2365,6 +2432,50 @@ TEST_F(RegExpTestWithContext, RegExpInterruptReentrantExecution) {
   CHECK(IsNull(*result));
 }
 
+TEST(RegExpBytecodeCacheTest, LookupMatchesWholeKey) {
+  RegExpBytecodeCache cache;
+  auto make_key = [](const char* source, bool is_one_byte) {
+    return RegExpBytecodeCache::Key{
+        std::vector<base::uc16>(source, source + strlen(source)),
+        RegExpFlag::kGlobal, is_one_byte, JSRegExp::kNoBacktrackLimit,
+        FlagList::Hash()};
+  };
+  auto entry = std::make_shared<RegExpBytecodeCache::Entry>();
+  entry->bytecode = {1, 2, 3, 4};
+  entry->register_count = 2;
+  cache.Insert(make_key("a+b", true), entry);
+
+  EXPECT_EQ(entry, cache.Lookup(make_key("a+b", true)));
+  EXPECT_EQ(nullptr, cache.Lookup(make_key("a+b", false)));
+  EXPECT_EQ(nullptr, cache.Lookup(make_key("a+c", true)));
+  RegExpBytecodeCache::Key key = make_key("a+b", true);
+  key.flags = RegExpFlag::kIgnoreCase;
+  EXPECT_EQ(nullptr, cache.Lookup(key));
+
+  // A second insertion of the same key keeps the first entry.
+  cache.Insert(make_key("a+b", true),
+               std::make_shared<RegExpBytecodeCache::Entry>());
+  EXPECT_EQ(entry, cache.Lookup(make_key("a+b", true)));
+}
+
+TEST_F(RegExpTestWithContext, SharedBytecodeCacheRestoresCaptureNames) {
+  FlagScope<bool> interpret_all(&v8_flags.regexp_interpret_all, true);
+  FlagScope<bool> shared_cache(&v8_flags.regexp_shared_bytecode_cache, true);
+  v8::HandleScope scope(isolate());
+  RunJS(
+      "function Make() {"
+      "  return new RegExp('(?<year>\\\\d{4})-(?<month>\\\\d{2})');"
+      "}"
+      "Make().exec('2024-05');");
+  // Without the isolate's compilation cache, the next regexp gets its own
+  // data and is compiled from the shared bytecode.
+  i_isolate()->compilation_cache()->Clear();
+  v8::Local<v8::Value> result =
+      RunJS("const groups = Make().exec('1999-12').groups;"
+            "groups.year + groups.month;");
+  EXPECT_EQ(0, strcmp("199912", *v8::String::Utf8Value(isolate(), result)));
+}
+
 #undef CHECK_PARSE_ERROR
 #undef CHECK_SIMPLE
 #undef CHECK_MIN_MAX
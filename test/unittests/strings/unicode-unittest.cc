@@ -495,6 +495,66 @@ TEST(UnicodeTest, IncrementalUTF8DecodingVsNonIncrementalUtf8Decoding) {
   }
 }
 
+TEST(UnicodeTest, AsciiPrefixLength) {
+  // Covers the vector loop, the scalar tail and the boundary between them.
+  for (int length = 0; length < 50; length++) {
+    std::vector<uint8_t> bytes(length, 0x7F);
+    CHECK_EQ(length, AsciiPrefixLength(bytes.data(), length));
+    for (int i = 0; i < length; i++) {
+      for (uint8_t non_ascii : {0x80, 0xC3, 0xFF}) {
+        bytes[i] = non_ascii;
+        CHECK_EQ(i, AsciiPrefixLength(bytes.data(), length));
+        bytes[i] = 'a';
+      }
+    }
+  }
+}
+
+TEST(UnicodeTest, Utf8DecoderFastPathsVsIncrementalDecoding) {
+  // The Utf8Decoder skips over ASCII runs many bytes at a time and decodes
+  // two- and three-byte sequences without the DFA. Check that mixing these
+  // with sequences the DFA has to handle, at all offsets, gives the same result
+  // as the incremental decoder.
+  const std::vector<std::vector<uint8_t>> pieces = {
+      {'a'},
+      {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd',
+       'e', 'f', 'g'},
+      {0xC3, 0xA9},              // U+00E9
+      {0xCE, 0xBA},              // U+03BA
+      {0xE2, 0x82, 0xAC},        // U+20AC
+      {0xEF, 0xBF, 0xBF},        // U+FFFF
+      {0xF0, 0x9F, 0x98, 0x8D},  // U+1F60D
+      {0xC0, 0xAF},              // Overlong.
+      {0xE0, 0x80, 0xAF},        // Overlong.
+      {0xED, 0xA0, 0x80},        // Surrogate.
+      {0xE2, 0x82},              // Truncated.
+      {0xC3},                    // Truncated.
+      {0x80},                    // Lone continuation byte.
+      {0xFF},
+  };
+  for (size_t prefix = 0; prefix < 20; prefix++) {
+    for (size_t first = 0; first < pieces.size(); first++) {
+      for (size_t second = 0; second < pieces.size(); second++) {
+        std::vector<uint8_t> bytes(prefix, 'x');
+        for (int i = 0; i < 3; i++) {
+          bytes.insert(bytes.end(), pieces[first].begin(), pieces[first].end());
+          bytes.insert(bytes.end(), pieces[second].begin(),
+                       pieces[second].end());
+        }
+
+        std::vector<unibrow::uchar> output_incremental;
+        DecodeIncrementally(bytes, &output_incremental);
+        std::vector<unibrow::uchar> output_utf16;
+        DecodeUtf16(bytes, &output_utf16);
+        CHECK_EQ(output_utf16.size(), output_incremental.size());
+        for (size_t i = 0; i < output_utf16.size(); ++i) {
+          CHECK_EQ(output_utf16[i], output_incremental[i]);
+        }
+      }
+    }
+  }
+}
+
 class UnicodeWithGCTest : public TestWithHeapInternals {};
 
 #define GC_INSIDE_NEW_STRING_FROM_UTF8_SUB_STRING(NAME, STRING)                \